@@ -1,45 +1,168 @@
 #pragma once
+#include "ArrayView.h"
+#include "../../Memory/include/MallocAllocator.h"
+#include <memory>
 
 namespace dsa {
-    template<typename T>
+    // Growth policies: grow(capacity, required) returns the new capacity (>= required)
+    // used when an Array runs out of room.
+
+    // Doubles the capacity: fewest reallocations, up to 50% slack
+    struct DoublingGrowth {
+        static int grow(int capacity, int required) {
+            return (capacity * 2 > required) ? capacity * 2 : required;
+        }
+    };
+
+    // Grows by 1.5x: less slack, and freed blocks can be reused by later growth
+    struct OneAndHalfGrowth {
+        static int grow(int capacity, int required) {
+            int grown = capacity + capacity / 2 + 1;
+            return (grown > required) ? grown : required;
+        }
+    };
+
+    // Grows by a fixed number of slots: bounded slack for memory-sensitive use
+    template<int Chunk = 64>
+    struct ChunkGrowth {
+        static_assert(Chunk > 0, "ChunkGrowth needs a positive chunk size");
+        static int grow(int capacity, int required) {
+            int grown = capacity + Chunk;
+            return (grown > required) ? grown : ((required + Chunk - 1) / Chunk) * Chunk;
+        }
+    };
+
+    // Allocator is any std::allocator-compatible allocator for T. The default,
+    // MallocAllocator, lets trivially copyable elements grow in place with realloc.
+    template<typename T, typename GrowthPolicy = DoublingGrowth, typename Allocator = MallocAllocator<T>>
     class Array {
         private:
-            T* data; // pointer to heap memory
+            using AllocatorTraits = std::allocator_traits<Allocator>;
+            static_assert(std::is_same<typename AllocatorTraits::value_type, T>::value,
+                "Array<T, GrowthPolicy, Allocator> needs an allocator of T");
+
+            T* elements; // pointer to uninitialized heap (or inline) memory, only [0, size) holds live elements
             int size; // number of elements in the array
             int capacity; // total capacity of the array
+            T* inlineStorage; // fixed in-object buffer provided by SmallArray, nullptr for a plain Array
+            int inlineCapacity; // number of slots in inlineStorage
+            Allocator allocator; // source of the heap blocks, stays with this array for its lifetime
 
-            void resize(); // resize the array when capacity is reached
+            T* allocate(int slots); // allocates raw storage for slots elements
+            void deallocate(T* block, int slots); // returns a block obtained from allocate(slots)
+            bool usesInlineStorage() const; // true if elements currently points at inlineStorage
+            void releaseStorage(); // frees elements unless it is the inline buffer
+            void destroyRange(int from, int to); // runs destructors on elements[from, to)
+            void resize(int newCapacity); // moves the elements into a buffer of newCapacity slots
+            void ensureCapacity(int required); // grows once (per GrowthPolicy) so that at least required slots exist
             void shiftRight(int index); // helper to shift elements right from index
             void shiftLeft(int index); // helper to shift elements left from index
-            int partition(int low, int high); // helper for quick sort
-            void quickSortHelper(int low, int high); // recursive quick sort helper
+            static constexpr int INSERTION_SORT_THRESHOLD = 16; // partitions this small are insertion sorted
+            static constexpr int NINTHER_THRESHOLD = 128; // partitions larger than this use a ninther pivot
+            static constexpr int PARALLEL_SORT_THRESHOLD = 1 << 16; // parallelSort falls back to quickSort below this size
+            static constexpr int PARALLEL_SORT_MIN_CHUNK = 1 << 14; // smallest chunk handed to one parallelSort worker
+            static constexpr int BATCH_SEARCH_GROUP = 16; // lookups interleaved per group in batchSearch
+            // buffers are only stolen between equal allocators, so move assignment and swap
+            // can only promise not to throw when every two allocators compare equal
+            static constexpr bool ALLOCATORS_ALWAYS_EQUAL = AllocatorTraits::is_always_equal::value;
+
+            int medianOfThree(int a, int b, int c); // index of the median of elements[a], elements[b], elements[c]
+            void partition(int low, int high, int& lt, int& gt); // three-way partition helper for quick sort
+            void insertionSortRange(int low, int high); // insertion sort on elements[low, high]
+            void siftDown(int low, int root, int count); // heap helper for heapSortRange
+            void heapSortRange(int low, int high); // heap sort on elements[low, high], introsort fallback
+            void introSortLoop(int low, int high, int depthLimit); // quick sort loop with depth limit
+            void sortRange(int low, int high); // serial introsort on elements[low, high]
+            static const T* lowerBound(const T* base, int count, const T& value); // branchless lower bound
+
+        protected:
+            Array(T* inlineStorage, int inlineCapacity, const Allocator& allocator) noexcept; // Starts out in a caller-owned inline buffer (SmallArray)
+            void moveFrom(Array& other); // steals other's buffer if possible, else moves its elements one by one (may throw)
 
         public:
             Array(); // Constructor
+            explicit Array(const Allocator& allocator); // Constructor drawing memory from allocator
+            explicit Array(int initialCapacity, const Allocator& allocator = Allocator()); // Constructor with initial capacity
+            Array(const Array& other); // Copy constructor (deep copy)
+            Array(Array&& other) noexcept; // Move constructor, steals other's buffer and leaves other empty
+            Array& operator=(const Array& other); // Copy assignment (deep copy)
+            Array& operator=(Array&& other) noexcept(ALLOCATORS_ALWAYS_EQUAL); // Move assignment, leaves other empty (may throw if the allocators differ)
             ~Array(); // Destructor
 
             // core array operations
-            void push(T value); // Adds element at the end of the array
+            void push(const T& value); // Adds a copy of value at the end of the array
+            void push(T&& value); // Moves value to the end of the array
+            template<typename... Args>
+            T& emplaceBack(Args&&... args); // Constructs an element in place at the end of the array
             T pop(); // Removes and returns the last element of the array
             void insert(int index, T value); // Inserts element at specified index
             T remove(int index); // Removes and returns element at specified index
-            T get(int index); // Returns element at specified index
+            void insertRange(int index, const T* values, int count); // Inserts count elements at specified index (values may point into this array)
+            void removeRange(int index, int count); // Removes count elements starting at specified index
+            void append(const T* values, int count); // Adds count elements at the end of the array
+            const T& get(int index) const; // Returns element at specified index
             void set(int index, T value); // Modifies element at specified index
+            T& at(int index); // Returns a reference to the element at specified index (bounds checked)
+            const T& at(int index) const; // Returns a reference to the element at specified index (bounds checked)
+            T& operator[](int index); // Returns a reference to the element at specified index (unchecked)
+            const T& operator[](int index) const; // Returns a reference to the element at specified index (unchecked)
 
             // Search algorithms -> returns index of the found element or -1 if not found
             int linearSearch(T value); // Returns index of the found element or -1 if not found
             int binarySearch(T value); // Returns index of the found element or -1 if not found
+            void batchSearch(const T* values, int count, int* results); // binarySearch for many values, results[i] = index or -1
 
             // Sorting algorithms -> sorts array in place
             void bubbleSort(); 
             void insertionSort();
             void quickSort();
+            void parallelSort(int threads = 0); // parallel merge sort, threads <= 0 uses all hardware threads
+            void radixSort(); // LSD radix sort for integral and floating-point T, quickSort otherwise
 
             // utility methods
-            int getSize(); // Returns the current number of elements in the array
-            int getCapacity(); // Returns the current capacity of the array
-            bool isEmpty(); // Returns true if array is empty, false otherwise
+            int getSize() const; // Returns the current number of elements in the array
+            int getCapacity() const; // Returns the current capacity of the array
+            void reserve(int newCapacity); // Grows the capacity to at least newCapacity
+            void shrinkToFit(); // Releases unused capacity (capacity becomes size)
+            bool isEmpty() const; // Returns true if array is empty, false otherwise
+            Allocator getAllocator() const; // Returns a copy of the allocator
+            void swap(Array& other) noexcept(ALLOCATORS_ALWAYS_EQUAL); // Exchanges the contents of two arrays, O(1) unless one of them is inline (may throw if the allocators differ)
+
+            // iteration and views (contiguous iterators: plain pointers)
+            T* begin(); // Returns a pointer to the first element
+            const T* begin() const; // Returns a pointer to the first element
+            T* end(); // Returns a pointer one past the last element
+            const T* end() const; // Returns a pointer one past the last element
+            T* data(); // Returns a pointer to the underlying buffer
+            const T* data() const; // Returns a pointer to the underlying buffer
+            ArrayView<T> view(); // Returns a non-owning view of all elements
+            ArrayView<const T> view() const; // Returns a non-owning read-only view of all elements
+            ArrayView<T> view(int offset, int count); // Returns a non-owning view of elements [offset, offset + count)
+            ArrayView<const T> view(int offset, int count) const; // Returns a non-owning read-only view of elements [offset, offset + count)
             void reverse(); // reverses the array in place
             void print(); // Outputs all the elements in the array
     };
-}
\ No newline at end of file
+}
+
+#include "Array.tpp"
+
+#ifdef DSA_EXPLICIT_INSTANTIATION
+#include <string>
+
+// Instantiated once in src/Array.cpp instead of in every translation unit
+extern template class dsa::Array<int>;
+extern template class dsa::Array<float>;
+extern template class dsa::Array<double>;
+extern template class dsa::Array<char>;
+extern template class dsa::Array<std::string>;
+extern template class dsa::Array<int, dsa::OneAndHalfGrowth>;
+extern template class dsa::Array<float, dsa::OneAndHalfGrowth>;
+extern template class dsa::Array<double, dsa::OneAndHalfGrowth>;
+extern template class dsa::Array<char, dsa::OneAndHalfGrowth>;
+extern template class dsa::Array<std::string, dsa::OneAndHalfGrowth>;
+extern template class dsa::Array<int, dsa::ChunkGrowth<>>;
+extern template class dsa::Array<float, dsa::ChunkGrowth<>>;
+extern template class dsa::Array<double, dsa::ChunkGrowth<>>;
+extern template class dsa::Array<char, dsa::ChunkGrowth<>>;
+extern template class dsa::Array<std::string, dsa::ChunkGrowth<>>;
+#endif
\ No newline at end of file
@@ -0,0 +1,1353 @@
+#pragma once
+// Template definitions for Array.h (included at the end of Array.h)
+#include <algorithm>
+#include <condition_variable>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <functional>
+#include <iostream>
+#include <mutex>
+#include <new>
+#include <stdexcept>
+#include <thread>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+// SIMD linearSearch kernels need x86-64 (SSE2 baseline) and GCC/Clang target attributes
+#if defined(__x86_64__) && (defined(__GNUC__) || defined(__clang__))
+#define DSA_ARRAY_X86_SIMD 1
+#include <immintrin.h>
+#else
+#define DSA_ARRAY_X86_SIMD 0
+#endif
+
+#ifndef DSA_PREFETCH
+#if defined(__GNUC__) || defined(__clang__)
+#define DSA_PREFETCH(address) __builtin_prefetch(address)
+#else
+#define DSA_PREFETCH(address) ((void)0)
+#endif
+#endif
+
+namespace dsa {
+    template<typename T, typename GrowthPolicy, typename Allocator>
+    T* Array<T, GrowthPolicy, Allocator>::allocate(int slots) {
+        // raw, uninitialized storage: no T is constructed until it is pushed
+        if (slots == 0) {
+            return nullptr;
+        }
+        return AllocatorTraits::allocate(allocator, static_cast<size_t>(slots));
+    }
+
+    template<typename T, typename GrowthPolicy, typename Allocator>
+    void Array<T, GrowthPolicy, Allocator>::deallocate(T* block, int slots) {
+        if (block != nullptr) {
+            AllocatorTraits::deallocate(allocator, block, static_cast<size_t>(slots));
+        }
+    }
+
+    template<typename T, typename GrowthPolicy, typename Allocator>
+    bool Array<T, GrowthPolicy, Allocator>::usesInlineStorage() const {
+        return inlineStorage != nullptr && elements == inlineStorage;
+    }
+
+    template<typename T, typename GrowthPolicy, typename Allocator>
+    void Array<T, GrowthPolicy, Allocator>::releaseStorage() {
+        // the inline buffer belongs to the enclosing SmallArray, only heap blocks are freed
+        if (!usesInlineStorage()) {
+            deallocate(elements, capacity);
+        }
+    }
+
+    template<typename T, typename GrowthPolicy, typename Allocator>
+    void Array<T, GrowthPolicy, Allocator>::destroyRange(int from, int to) {
+        if constexpr (!std::is_trivially_destructible<T>::value) {
+            for (int i = from; i < to; i++) {
+                elements[i].~T();
+            }
+        }
+    }
+
+    template<typename T, typename GrowthPolicy, typename Allocator>
+    Array<T, GrowthPolicy, Allocator>::Array() : Array(Allocator()) {}
+
+    template<typename T, typename GrowthPolicy, typename Allocator>
+    Array<T, GrowthPolicy, Allocator>::Array(const Allocator& allocator)
+        : inlineStorage(nullptr), inlineCapacity(0), allocator(allocator) {
+        capacity = 10; // initial capacity
+        size = 0; // number of elements
+        elements = allocate(capacity); // allocate uninitialized heap memory
+    }
+
+    template<typename T, typename GrowthPolicy, typename Allocator>
+    Array<T, GrowthPolicy, Allocator>::Array(T* inlineStorage, int inlineCapacity, const Allocator& allocator) noexcept
+        : elements(inlineStorage), size(0), capacity(inlineCapacity),
+          inlineStorage(inlineStorage), inlineCapacity(inlineCapacity), allocator(allocator) {
+        // no allocation: the first inlineCapacity elements live in the caller's buffer
+    }
+
+    template<typename T, typename GrowthPolicy, typename Allocator>
+    Array<T, GrowthPolicy, Allocator>::Array(const Array& other)
+        : inlineStorage(nullptr), inlineCapacity(0),
+          allocator(AllocatorTraits::select_on_container_copy_construction(other.allocator)) {
+        /*
+        Algorithm for the copy constructor (deep copy):
+            1. allocate the same capacity as other
+            2. trivially copyable T: memcpy the elements
+            3. otherwise: copy-construct each element in place
+        */
+        capacity = other.capacity;
+        size = 0;
+        elements = allocate(capacity);
+        if constexpr (std::is_trivially_copyable<T>::value) {
+            if (other.size > 0) {
+                std::memcpy(elements, other.elements, static_cast<size_t>(other.size) * sizeof(T));
+            }
+            size = other.size;
+        } else {
+            try {
+                for (; size < other.size; size++) {
+                    new (&elements[size]) T(other.elements[size]);
+                }
+            } catch (...) {
+                destroyRange(0, size);
+                deallocate(elements, capacity);
+                throw;
+            }
+        }
+    }
+
+    template<typename T, typename GrowthPolicy, typename Allocator>
+    Array<T, GrowthPolicy, Allocator>::Array(Array&& other) noexcept
+        : elements(other.elements), size(other.size), capacity(other.capacity), inlineStorage(nullptr), inlineCapacity(0),
+          allocator(other.allocator) {
+        // steal the buffer, other is left as a valid empty array. other is never inline here:
+        // SmallArray hides its Array base, so it cannot be moved into a plain Array
+        other.elements = nullptr;
+        other.size = 0;
+        other.capacity = 0;
+    }
+
+    template<typename T, typename GrowthPolicy, typename Allocator>
+    Array<T, GrowthPolicy, Allocator>& Array<T, GrowthPolicy, Allocator>::operator=(const Array& other) {
+        /*
+        Algorithm for copy assignment:
+            1. heap array: copy other into a new array that uses this array's
+               allocator, then swap (this is left untouched if copying throws)
+            2. array with inline storage: destroy the elements, reserve room for
+               other's elements (staying inline if they fit) and copy them in
+            -> the allocator is never propagated, this keeps its own
+        */
+        if (this == &other) {
+            return *this;
+        }
+        if (inlineStorage == nullptr) {
+            Array copy(other.capacity, allocator);
+            copy.append(other.elements, other.size);
+            swap(copy);
+            return *this;
+        }
+        destroyRange(0, size);
+        size = 0;
+        reserve(other.size);
+        if constexpr (std::is_trivially_copyable<T>::value) {
+            if (other.size > 0) {
+                std::memcpy(elements, other.elements, static_cast<size_t>(other.size) * sizeof(T));
+            }
+            size = other.size;
+        } else {
+            for (; size < other.size; size++) {
+                new (&elements[size]) T(other.elements[size]);
+            }
+        }
+        return *this;
+    }
+
+    template<typename T, typename GrowthPolicy, typename Allocator>
+    void Array<T, GrowthPolicy, Allocator>::moveFrom(Array& other) {
+        /*
+        Algorithm to move other's contents into this array:
+            1. destroy this array's elements
+            2. other on the heap with an equal allocator: free this buffer (unless
+               inline), steal other's buffer and point other back at its own
+               inline storage (or nullptr)
+            3. other inline, or its memory belongs to a different allocator: the
+               buffer cannot be stolen, so move the elements one by one into this
+               array (growing it first if needed, which may throw)
+        */
+        if (this == &other) {
+            return;
+        }
+        destroyRange(0, size);
+        size = 0;
+        if (!other.usesInlineStorage() && allocator == other.allocator) {
+            releaseStorage();
+            elements = other.elements;
+            size = other.size;
+            capacity = other.capacity;
+            other.elements = other.inlineStorage;
+            other.size = 0;
+            other.capacity = other.inlineCapacity;
+            return;
+        }
+        if (capacity < other.size) {
+            resize(other.capacity);
+        }
+        for (; size < other.size; size++) {
+            new (&elements[size]) T(std::move(other.elements[size]));
+        }
+        other.destroyRange(0, other.size);
+        other.size = 0;
+    }
+
+    template<typename T, typename GrowthPolicy, typename Allocator>
+    Array<T, GrowthPolicy, Allocator>& Array<T, GrowthPolicy, Allocator>::operator=(Array&& other) noexcept(ALLOCATORS_ALWAYS_EQUAL) {
+        // noexcept only when allocators always compare equal: a plain array's heap buffer can then always be stolen
+        moveFrom(other);
+        return *this;
+    }
+
+    template<typename T, typename GrowthPolicy, typename Allocator>
+    void Array<T, GrowthPolicy, Allocator>::swap(Array& other) noexcept(ALLOCATORS_ALWAYS_EQUAL) {
+        // heap buffers from equal allocators are exchanged in O(1), otherwise the elements are moved
+        if (!usesInlineStorage() && !other.usesInlineStorage() && allocator == other.allocator) {
+            std::swap(elements, other.elements);
+            std::swap(size, other.size);
+            std::swap(capacity, other.capacity);
+            return;
+        }
+        Array temp(std::move(other));
+        other.moveFrom(*this);
+        moveFrom(temp);
+    }
+
+    template<typename T, typename GrowthPolicy, typename Allocator>
+    Array<T, GrowthPolicy, Allocator>::Array(int initialCapacity, const Allocator& allocator)
+        : inlineStorage(nullptr), inlineCapacity(0), allocator(allocator) {
+        if (initialCapacity < 0) {
+            throw std::invalid_argument("Invalid capacity");
+        }
+        capacity = initialCapacity; // caller-chosen capacity, no growth until it is used up
+        size = 0; // number of elements
+        elements = allocate(capacity); // allocate uninitialized heap memory
+    }
+
+    template<typename T, typename GrowthPolicy, typename Allocator>
+    Array<T, GrowthPolicy, Allocator>::~Array() {
+        destroyRange(0, size); // destroy the live elements only
+        releaseStorage(); // free heap memory
+    }
+
+    template<typename T, typename GrowthPolicy, typename Allocator>
+    void Array<T, GrowthPolicy, Allocator>::resize(int newCapacity) {
+        /*
+        Algorithm to resize the array to newCapacity slots:
+            1. inline storage available and newCapacity fits in it: move the
+               elements back into the inline buffer (if they spilled) and free the heap block
+            2. trivially copyable T in a MallocAllocator block: realloc it (one bulk copy at most)
+            3. otherwise:
+                a. allocate larger uninitialized memory
+                b. move-construct (or copy, if the move may throw) each element into it
+                c. destroy the old elements and free the old memory (unless inline)
+                d. point elements to new memory
+        */
+       if (inlineStorage != nullptr && newCapacity <= inlineCapacity) {
+        if (!usesInlineStorage()) {
+            for (int i = 0; i < size; i++) {
+                new (&inlineStorage[i]) T(std::move_if_noexcept(elements[i]));
+            }
+            destroyRange(0, size);
+            deallocate(elements, capacity);
+            elements = inlineStorage;
+        }
+        capacity = inlineCapacity;
+        return;
+       }
+       if (newCapacity == 0) {
+        // only reachable from shrinkToFit() on an empty heap array
+        deallocate(elements, capacity);
+        elements = nullptr;
+       } else if (std::is_trivially_copyable<T>::value && IsMallocAllocator<Allocator>::value && !usesInlineStorage()) {
+        void* memory = std::realloc(static_cast<void*>(elements), static_cast<size_t>(newCapacity) * sizeof(T));
+        if (memory == nullptr) {
+            throw std::bad_alloc();
+        }
+        elements = static_cast<T*>(memory);
+       } else {
+        T* newData = allocate(newCapacity);
+        for (int i = 0; i < size; i++)
+        {
+            new (&newData[i]) T(std::move_if_noexcept(elements[i]));
+        }
+        destroyRange(0, size);
+        releaseStorage();
+        elements = newData;
+       }
+       capacity = newCapacity;
+    }
+
+    template<typename T, typename GrowthPolicy, typename Allocator>
+    void Array<T, GrowthPolicy, Allocator>::ensureCapacity(int required) {
+        // grows at most once: to the next GrowthPolicy step, or straight to required if that is larger
+        if (required > capacity) {
+            resize(GrowthPolicy::grow(capacity, required));
+        }
+    }
+
+    template<typename T, typename GrowthPolicy, typename Allocator>
+    void Array<T, GrowthPolicy, Allocator>::shiftRight(int index) {
+        /*
+        Algorithm to shift elements right from index:
+            1. trivially copyable T: memmove [index, size) one slot right
+            2. otherwise:
+                a. move-construct the last element into the uninitialized slot elements[size]
+                b. iterate from size-2 down to index, moving each element one position right
+            -> slot elements[index] is left holding a moved-from (but live) element,
+               unless index == size, in which case it is still uninitialized
+        */
+         if (index >= size) {
+            return;
+         }
+         if constexpr (std::is_trivially_copyable<T>::value) {
+            std::memmove(&elements[index + 1], &elements[index], static_cast<size_t>(size - index) * sizeof(T));
+         } else {
+            new (&elements[size]) T(std::move(elements[size - 1]));
+            for (int i = size - 2; i >= index; i--)
+            {
+               elements[i + 1] = std::move(elements[i]);
+            }
+         }
+    }
+
+    template<typename T, typename GrowthPolicy, typename Allocator>
+    void Array<T, GrowthPolicy, Allocator>::shiftLeft(int index) {
+        /*
+        Algorithm to shift elements left from index:
+            1. trivially copyable T: memmove (index, size) one slot left
+            2. otherwise: iterate from index to size-2, moving each element one position left
+            3. destroy the now-vacant last element elements[size-1]
+        */
+        if constexpr (std::is_trivially_copyable<T>::value) {
+            std::memmove(&elements[index], &elements[index + 1], static_cast<size_t>(size - index - 1) * sizeof(T));
+        } else {
+            for (int i = index; i < size - 1; i++)
+            {
+                elements[i] = std::move(elements[i + 1]);
+            }
+            destroyRange(size - 1, size);
+        }
+    }
+
+    template<typename T, typename GrowthPolicy, typename Allocator>
+    template<typename... Args>
+    T& Array<T, GrowthPolicy, Allocator>::emplaceBack(Args&&... args) {
+        /*
+        Algorithm to construct an element at the end:
+            1. check if size == capacity
+            2. if full:
+                a. construct the element in a local first, since args may refer
+                   to an element of this array that growing would invalidate
+                b. grow the capacity with ensureCapacity()
+                c. move the local into elements[size]
+            3. otherwise construct the element in place at elements[size] from args
+            4. increment size and return a reference to the new element
+        */
+       if (size == capacity)
+       {
+        T value(std::forward<Args>(args)...);
+        ensureCapacity(size + 1);
+        new (&elements[size]) T(std::move(value));
+       } else {
+        new (&elements[size]) T(std::forward<Args>(args)...); // construct in the uninitialized slot
+       }
+       return elements[size++];
+    }
+
+    template<typename T, typename GrowthPolicy, typename Allocator>
+    void Array<T, GrowthPolicy, Allocator>::push(const T& value) {
+        // copies value into the new slot
+        emplaceBack(value);
+    }
+
+    template<typename T, typename GrowthPolicy, typename Allocator>
+    void Array<T, GrowthPolicy, Allocator>::push(T&& value) {
+        // moves value into the new slot, no copy
+        emplaceBack(std::move(value));
+    }
+
+    template<typename T, typename GrowthPolicy, typename Allocator>
+    T Array<T, GrowthPolicy, Allocator>::pop() {
+        /*
+        Algorithm to remove and return the last element:
+            1. check if array is empty
+            2. decrement size
+            3. move elements[size] out, destroy the slot and return the value
+        */
+       if(isEmpty()) {
+            throw std::out_of_range("Cannot pop from empty array");
+       }
+       T value = std::move(elements[--size]);
+       destroyRange(size, size + 1);
+       return value;
+    }
+
+    template<typename T, typename GrowthPolicy, typename Allocator>
+    void Array<T, GrowthPolicy, Allocator>::insert(int index, T value) {
+        /*
+        Algorithm to insert an element at index:
+            1. check if size == capacity
+            2. if full, grow the capacity with ensureCapacity()
+            3. shift elements right from index
+            4. set elements[index] = value (construct it if index == size)
+            5. increment size
+        */
+       if (index < 0 || index > size) {
+        throw std::out_of_range("Invalid index");
+       }
+       if (size == capacity) {
+        ensureCapacity(size + 1);
+       }
+       if (index == size) {
+        new (&elements[index]) T(std::move(value));
+       } else {
+        shiftRight(index);
+        elements[index] = std::move(value);
+       }
+        size++;
+    }
+
+    template<typename T, typename GrowthPolicy, typename Allocator>
+    T Array<T, GrowthPolicy, Allocator>::remove(int index) {
+        /*
+        Algorithm to remove and return element at index:
+            1. move elements[index] into temp
+            2. shift elements left from index (destroys the vacated last slot)
+            3. decrement size
+            4. return temp
+        */
+        if (index < 0 || index >= size) {
+            throw std::out_of_range("Invalid index");
+        }
+       T temp = std::move(elements[index]);
+       shiftLeft(index);
+        size--;
+        return temp;
+    }
+
+    template<typename T, typename GrowthPolicy, typename Allocator>
+    void Array<T, GrowthPolicy, Allocator>::insertRange(int index, const T* values, int count) {
+        /*
+        Algorithm to insert count elements at index:
+            1. validate index and count
+            2. reserve room for size + count elements with a single resize
+            3. shift the tail [index, size) right by count in one pass:
+                -> trivially copyable T: one memmove, then one memcpy of the new block
+                -> otherwise: move each tail element from the back, constructing it
+                   if its new slot lies past size and move-assigning it otherwise,
+                   then copy the new block into place the same way
+            4. increase size by count
+            -> values may point into this array: growing or shifting would move them
+               from under the copy, so such a range is copied out first
+        */
+        if (index < 0 || index > size || count < 0) {
+            throw std::out_of_range("Invalid index");
+        }
+        if (count == 0) {
+            return;
+        }
+        if (!std::less<const T*>()(values, elements) && std::less<const T*>()(values, elements + size)) {
+            Array copy(count, allocator);
+            copy.append(values, count);
+            insertRange(index, copy.elements, count);
+            return;
+        }
+        ensureCapacity(size + count);
+
+        if constexpr (std::is_trivially_copyable<T>::value) {
+            std::memmove(&elements[index + count], &elements[index], static_cast<size_t>(size - index) * sizeof(T));
+            std::memcpy(&elements[index], values, static_cast<size_t>(count) * sizeof(T));
+        } else {
+            for (int i = size - 1; i >= index; i--) {
+                if (i + count >= size) {
+                    new (&elements[i + count]) T(std::move(elements[i]));
+                } else {
+                    elements[i + count] = std::move(elements[i]);
+                }
+            }
+            for (int i = 0; i < count; i++) {
+                if (index + i >= size) {
+                    new (&elements[index + i]) T(values[i]);
+                } else {
+                    elements[index + i] = values[i];
+                }
+            }
+        }
+        size += count;
+    }
+
+    template<typename T, typename GrowthPolicy, typename Allocator>
+    void Array<T, GrowthPolicy, Allocator>::removeRange(int index, int count) {
+        /*
+        Algorithm to remove count elements starting at index:
+            1. validate the range [index, index + count)
+            2. shift the tail [index + count, size) left by count in one pass
+               (one memmove for trivially copyable T, move assignment otherwise)
+            3. destroy the last count slots and decrease size by count
+        */
+        if (index < 0 || count < 0 || index + count > size) {
+            throw std::out_of_range("Invalid index");
+        }
+        if (count == 0) {
+            return;
+        }
+        if constexpr (std::is_trivially_copyable<T>::value) {
+            std::memmove(&elements[index], &elements[index + count], static_cast<size_t>(size - index - count) * sizeof(T));
+        } else {
+            for (int i = index + count; i < size; i++) {
+                elements[i - count] = std::move(elements[i]);
+            }
+            destroyRange(size - count, size);
+        }
+        size -= count;
+    }
+
+    template<typename T, typename GrowthPolicy, typename Allocator>
+    void Array<T, GrowthPolicy, Allocator>::append(const T* values, int count) {
+        // appending is inserting at the end: one resize, no tail to shift
+        insertRange(size, values, count);
+    }
+
+    template<typename T, typename GrowthPolicy, typename Allocator>
+    const T& Array<T, GrowthPolicy, Allocator>::get(int index) const {
+        return at(index);
+    }
+
+    template<typename T, typename GrowthPolicy, typename Allocator>
+    void Array<T, GrowthPolicy, Allocator>::set(int index, T value) {
+        at(index) = std::move(value);
+    }
+
+    template<typename T, typename GrowthPolicy, typename Allocator>
+    T& Array<T, GrowthPolicy, Allocator>::at(int index) {
+        if (index < 0 || index >= size) {
+            throw std::out_of_range("Invalid index");
+        }
+        return elements[index];
+    }
+
+    template<typename T, typename GrowthPolicy, typename Allocator>
+    const T& Array<T, GrowthPolicy, Allocator>::at(int index) const {
+        if (index < 0 || index >= size) {
+            throw std::out_of_range("Invalid index");
+        }
+        return elements[index];
+    }
+
+    template<typename T, typename GrowthPolicy, typename Allocator>
+    T& Array<T, GrowthPolicy, Allocator>::operator[](int index) {
+        return elements[index]; // unchecked, like a built-in array
+    }
+
+    template<typename T, typename GrowthPolicy, typename Allocator>
+    const T& Array<T, GrowthPolicy, Allocator>::operator[](int index) const {
+        return elements[index];
+    }
+
+#if DSA_ARRAY_X86_SIMD
+    namespace detail {
+        /*
+        SIMD kernels for linearSearch on int, float, double and char.
+        Every kernel compares a whole vector of elements against a broadcast copy
+        of the value, collapses the comparison into a byte mask with movemask and
+        uses the lowest set bit to locate the first match. SSE2 is part of the
+        x86-64 baseline; the AVX2 kernels are compiled with a target attribute and
+        are only called when the CPU reports AVX2 support at runtime.
+        */
+        inline __m128i broadcast128(int value) { return _mm_set1_epi32(value); }
+        inline __m128i broadcast128(char value) { return _mm_set1_epi8(value); }
+        inline __m128i broadcast128(float value) { return _mm_castps_si128(_mm_set1_ps(value)); }
+        inline __m128i broadcast128(double value) { return _mm_castpd_si128(_mm_set1_pd(value)); }
+
+        inline __m128i equal128(__m128i a, __m128i b, int) { return _mm_cmpeq_epi32(a, b); }
+        inline __m128i equal128(__m128i a, __m128i b, char) { return _mm_cmpeq_epi8(a, b); }
+        inline __m128i equal128(__m128i a, __m128i b, float) {
+            return _mm_castps_si128(_mm_cmpeq_ps(_mm_castsi128_ps(a), _mm_castsi128_ps(b)));
+        }
+        inline __m128i equal128(__m128i a, __m128i b, double) {
+            return _mm_castpd_si128(_mm_cmpeq_pd(_mm_castsi128_pd(a), _mm_castsi128_pd(b)));
+        }
+
+        template<typename T>
+        int linearSearchSse2(const T* elements, int size, T value) {
+            constexpr int LANES = 16 / sizeof(T);
+            const __m128i needle = broadcast128(value);
+            int i = 0;
+            for (; i + LANES <= size; i += LANES) {
+                __m128i chunk = _mm_loadu_si128(reinterpret_cast<const __m128i*>(elements + i));
+                int mask = _mm_movemask_epi8(equal128(chunk, needle, value));
+                if (mask != 0) {
+                    return i + __builtin_ctz(static_cast<unsigned>(mask)) / static_cast<int>(sizeof(T));
+                }
+            }
+            for (; i < size; i++) {
+                if (elements[i] == value) { return i; }
+            }
+            return -1;
+        }
+
+        __attribute__((target("avx2"))) inline __m256i broadcast256(int value) { return _mm256_set1_epi32(value); }
+        __attribute__((target("avx2"))) inline __m256i broadcast256(char value) { return _mm256_set1_epi8(value); }
+        __attribute__((target("avx2"))) inline __m256i broadcast256(float value) { return _mm256_castps_si256(_mm256_set1_ps(value)); }
+        __attribute__((target("avx2"))) inline __m256i broadcast256(double value) { return _mm256_castpd_si256(_mm256_set1_pd(value)); }
+
+        __attribute__((target("avx2"))) inline __m256i equal256(__m256i a, __m256i b, int) { return _mm256_cmpeq_epi32(a, b); }
+        __attribute__((target("avx2"))) inline __m256i equal256(__m256i a, __m256i b, char) { return _mm256_cmpeq_epi8(a, b); }
+        __attribute__((target("avx2"))) inline __m256i equal256(__m256i a, __m256i b, float) {
+            return _mm256_castps_si256(_mm256_cmp_ps(_mm256_castsi256_ps(a), _mm256_castsi256_ps(b), _CMP_EQ_OQ));
+        }
+        __attribute__((target("avx2"))) inline __m256i equal256(__m256i a, __m256i b, double) {
+            return _mm256_castpd_si256(_mm256_cmp_pd(_mm256_castsi256_pd(a), _mm256_castsi256_pd(b), _CMP_EQ_OQ));
+        }
+
+        template<typename T>
+        __attribute__((target("avx2"))) int linearSearchAvx2(const T* elements, int size, T value) {
+            constexpr int LANES = 32 / sizeof(T);
+            const __m256i needle = broadcast256(value);
+            int i = 0;
+            for (; i + LANES <= size; i += LANES) {
+                __m256i chunk = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(elements + i));
+                int mask = _mm256_movemask_epi8(equal256(chunk, needle, value));
+                if (mask != 0) {
+                    return i + __builtin_ctz(static_cast<unsigned>(mask)) / static_cast<int>(sizeof(T));
+                }
+            }
+            for (; i < size; i++) {
+                if (elements[i] == value) { return i; }
+            }
+            return -1;
+        }
+
+        inline bool cpuHasAvx2() {
+            static const bool hasAvx2 = __builtin_cpu_supports("avx2");
+            return hasAvx2;
+        }
+    }
+#endif
+
+    template<typename T, typename GrowthPolicy, typename Allocator>
+    int Array<T, GrowthPolicy, Allocator>::linearSearch(T value) {
+        /*
+        Algorithm for linear search:
+            1. int, float, double and char on x86-64: scan with the AVX2 kernel
+               (32 bytes per compare) if the CPU supports it, otherwise with the
+               SSE2 kernel (16 bytes per compare)
+            2. otherwise iterate through each element
+            3. if element matches value, return index
+            4. if not found, return -1
+        */
+#if DSA_ARRAY_X86_SIMD
+       if constexpr (std::is_same<T, int>::value || std::is_same<T, float>::value ||
+                     std::is_same<T, double>::value || std::is_same<T, char>::value) {
+            return detail::cpuHasAvx2() ? detail::linearSearchAvx2(elements, size, value) : detail::linearSearchSse2(elements, size, value);
+       }
+#endif
+       for (int i = 0; i < size; i++) {
+            if (elements[i] == value) { return i;}
+       }
+        return -1;
+    }
+
+    template<typename T, typename GrowthPolicy, typename Allocator>
+    const T* Array<T, GrowthPolicy, Allocator>::lowerBound(const T* base, int count, const T& value) {
+        /*
+        Algorithm for branchless lower bound over base[0, count):
+            1. while more than one candidate is left:
+                a. prefetch the midpoints of both possible next halves
+                b. half = count / 2; move base forward by half if base[half] < value
+                   (a conditional move, not a branch)
+                c. count -= half
+            2. step past the last candidate if it is still < value
+            -> returns a pointer to the first element >= value (or base + count)
+        */
+        if (count == 0) {
+            return base;
+        }
+        while (count > 1) {
+            int half = count / 2;
+            DSA_PREFETCH(base + half / 2);
+            DSA_PREFETCH(base + half + half / 2);
+            base = (base[half] < value) ? base + half : base;
+            count -= half;
+        }
+        return base + (*base < value);
+    }
+
+    template<typename T, typename GrowthPolicy, typename Allocator>
+    int Array<T, GrowthPolicy, Allocator>::binarySearch(T value) {
+        /*
+        Algorithm for binary search (array must be sorted):
+            1. find the first element >= value with the branchless lower bound
+               (no (low + high) / 2 overflow, no mispredicted branches)
+            2. if that element equals value, return its index (first occurrence)
+            3. if not found, return -1
+        */
+       int index = static_cast<int>(lowerBound(elements, size, value) - elements);
+       return (index < size && elements[index] == value) ? index : -1;
+    }
+
+    template<typename T, typename GrowthPolicy, typename Allocator>
+    void Array<T, GrowthPolicy, Allocator>::batchSearch(const T* values, int count, int* results) {
+        /*
+        Algorithm for batched binary search (array must be sorted):
+            1. take the queries in groups of BATCH_SEARCH_GROUP
+            2. advance every query in the group by one level of the branchless
+               lower bound before moving to the next level, prefetching each
+               query's next probes, so the cache misses of the whole group are
+               in flight at the same time instead of one after another
+            3. results[i] = index of values[i] (first occurrence) or -1
+        */
+        const T* bases[BATCH_SEARCH_GROUP];
+        for (int first = 0; first < count; first += BATCH_SEARCH_GROUP) {
+            int group = std::min(BATCH_SEARCH_GROUP, count - first);
+            for (int j = 0; j < group; j++) {
+                bases[j] = elements;
+            }
+
+            int remaining = size;
+            while (remaining > 1) {
+                int half = remaining / 2;
+                for (int j = 0; j < group; j++) {
+                    DSA_PREFETCH(bases[j] + half / 2);
+                    DSA_PREFETCH(bases[j] + half + half / 2);
+                    bases[j] = (bases[j][half] < values[first + j]) ? bases[j] + half : bases[j];
+                }
+                remaining -= half;
+            }
+
+            for (int j = 0; j < group; j++) {
+                int index = static_cast<int>(bases[j] - elements);
+                if (size > 0 && elements[index] < values[first + j]) {
+                    index++;
+                }
+                results[first + j] = (index < size && elements[index] == values[first + j]) ? index : -1;
+            }
+        }
+    }
+
+    template<typename T, typename GrowthPolicy, typename Allocator>
+    void Array<T, GrowthPolicy, Allocator>::bubbleSort() {
+        /*
+        Algorithm for bubble sort:
+            1. iterate through the array multiple times
+            2. in each pass, compare adjacent elements
+            3. if left > right, swap them
+            4. repeat until no swaps are needed
+        */
+       for (int i = 0; i < size - 1; i++) {
+            for (int j = 0; j < size - i - 1; j++) {
+                if (elements[j] > elements[j + 1]) {
+                    T temp = elements[j];
+                    elements[j] = elements[j + 1];
+                    elements[j + 1] = temp;
+                }
+            }
+        }
+    }
+
+    template<typename T, typename GrowthPolicy, typename Allocator>
+    void Array<T, GrowthPolicy, Allocator>::insertionSort() {
+        /*
+        Algorithm for insertion sort:
+            1. iterate from second element to end
+            2. for each element, compare with elements before it
+            3. shift larger elements right
+            4. insert the element at correct position
+        */
+        for (int i = 1; i < size; i++) {
+        T key = elements[i];
+        int j = i - 1;
+        // shift elements right
+        while (j >= 0 && elements[j] > key) {
+            elements[j + 1] = elements[j];
+            j--;
+        }
+        elements[j + 1] = key; // insert at correct position
+        }
+    }
+
+    template<typename T, typename GrowthPolicy, typename Allocator>
+    int Array<T, GrowthPolicy, Allocator>::medianOfThree(int a, int b, int c) {
+        // returns the index (a, b or c) holding the median of the three values
+        if (elements[a] < elements[b]) {
+            if (elements[b] < elements[c]) { return b; }
+            return (elements[a] < elements[c]) ? c : a;
+        }
+        if (elements[a] < elements[c]) { return a; }
+        return (elements[b] < elements[c]) ? c : b;
+    }
+
+    template<typename T, typename GrowthPolicy, typename Allocator>
+    void Array<T, GrowthPolicy, Allocator>::partition(int low, int high, int& lt, int& gt) {
+        /*
+        Algorithm to three-way partition the array for quick sort:
+            1. choose pivot:
+                -> median of three (low, mid, high) for small ranges
+                -> ninther (median of three medians of three) for large ranges
+            2. set lt = low, i = low, gt = high
+            3. while i <= gt:
+                a. if elements[i] < pivot: swap elements[lt] and elements[i], increment lt and i
+                b. if pivot < elements[i]: swap elements[i] and elements[gt], decrement gt
+                c. otherwise (equal to pivot): increment i
+            4. on return elements[low, lt) < pivot, elements[lt, gt] == pivot and
+               elements(gt, high] > pivot, so runs of duplicates are never revisited
+        */
+       int mid = low + (high - low) / 2;
+       int pivotIndex;
+       if (high - low + 1 > NINTHER_THRESHOLD) {
+        int step = (high - low + 1) / 8;
+        int first = medianOfThree(low, low + step, low + 2 * step);
+        int middle = medianOfThree(mid - step, mid, mid + step);
+        int last = medianOfThree(high - 2 * step, high - step, high);
+        pivotIndex = medianOfThree(first, middle, last);
+       } else {
+        pivotIndex = medianOfThree(low, mid, high);
+       }
+       T pivot = elements[pivotIndex];
+
+       lt = low;
+       gt = high;
+       int i = low;
+       while (i <= gt) {
+            if (elements[i] < pivot) {
+                std::swap(elements[lt++], elements[i++]);
+            } else if (pivot < elements[i]) {
+                std::swap(elements[i], elements[gt--]);
+            } else {
+                i++;
+            }
+       }
+    }
+
+    template<typename T, typename GrowthPolicy, typename Allocator>
+    void Array<T, GrowthPolicy, Allocator>::insertionSortRange(int low, int high) {
+        // insertion sort restricted to elements[low, high], used for small partitions
+        for (int i = low + 1; i <= high; i++) {
+            T key = std::move(elements[i]);
+            int j = i - 1;
+            while (j >= low && key < elements[j]) {
+                elements[j + 1] = std::move(elements[j]);
+                j--;
+            }
+            elements[j + 1] = std::move(key);
+        }
+    }
+
+    template<typename T, typename GrowthPolicy, typename Allocator>
+    void Array<T, GrowthPolicy, Allocator>::siftDown(int low, int root, int count) {
+        // restores the max-heap property below root for the heap stored in elements[low, low + count)
+        while (true) {
+            int child = 2 * root + 1;
+            if (child >= count) {
+                return;
+            }
+            if (child + 1 < count && elements[low + child] < elements[low + child + 1]) {
+                child++;
+            }
+            if (!(elements[low + root] < elements[low + child])) {
+                return;
+            }
+            std::swap(elements[low + root], elements[low + child]);
+            root = child;
+        }
+    }
+
+    template<typename T, typename GrowthPolicy, typename Allocator>
+    void Array<T, GrowthPolicy, Allocator>::heapSortRange(int low, int high) {
+        /*
+        Algorithm for heap sort on elements[low, high] (introsort fallback):
+            1. build a max heap by sifting down every internal node
+            2. repeatedly swap the root (maximum) with the last heap element,
+               shrink the heap by one and sift the new root down
+        */
+       int count = high - low + 1;
+       for (int root = count / 2 - 1; root >= 0; root--) {
+        siftDown(low, root, count);
+       }
+       for (int end = count - 1; end > 0; end--) {
+        std::swap(elements[low], elements[low + end]);
+        siftDown(low, 0, end);
+       }
+    }
+
+    template<typename T, typename GrowthPolicy, typename Allocator>
+    void Array<T, GrowthPolicy, Allocator>::introSortLoop(int low, int high, int depthLimit) {
+        /*
+        Algorithm for the introsort loop:
+            1. while the range is larger than INSERTION_SORT_THRESHOLD:
+                a. if depthLimit is exhausted, heap sort the range and stop
+                b. three-way partition the range into < pivot, == pivot, > pivot
+                c. recurse into the smaller side, loop on the larger side
+                   (keeps the recursion depth at O(log n))
+            2. small ranges are left for the final insertion sort pass
+        */
+       while (high - low + 1 > INSERTION_SORT_THRESHOLD) {
+        if (depthLimit == 0) {
+            heapSortRange(low, high);
+            return;
+        }
+        depthLimit--;
+
+        int lt, gt;
+        partition(low, high, lt, gt);
+
+        if (lt - low < high - gt) {
+            introSortLoop(low, lt - 1, depthLimit); // Sort smaller left partition
+            low = gt + 1;
+        } else {
+            introSortLoop(gt + 1, high, depthLimit); // Sort smaller right partition
+            high = lt - 1;
+        }
+       }
+    }
+
+    template<typename T, typename GrowthPolicy, typename Allocator>
+    void Array<T, GrowthPolicy, Allocator>::sortRange(int low, int high) {
+        /*
+        Algorithm to sort elements[low, high] (introsort):
+            1. set depthLimit = 2 * floor(log2(high - low + 1))
+            2. run the introsort loop: quick sort with ninther / median-of-three
+               pivots and three-way partitioning, falling back to heap sort
+               when depthLimit is exhausted (guarantees O(n log n))
+            3. finish with one insertion sort pass over the nearly sorted range
+        */
+        if (low < high) {
+            int depthLimit = 0;
+            for (int n = high - low + 1; n > 1; n >>= 1) {
+                depthLimit += 2;
+            }
+            introSortLoop(low, high, depthLimit);
+            insertionSortRange(low, high);
+        }
+    }
+
+    template<typename T, typename GrowthPolicy, typename Allocator>
+    void Array<T, GrowthPolicy, Allocator>::quickSort() {
+        sortRange(0, size - 1);
+    }
+
+    namespace detail {
+        // Runs task(0) ... task(workers - 1) on their own threads and waits for all of them.
+        // Worker 0 runs on the calling thread.
+        template<typename Task>
+        void runWorkers(int workers, Task task) {
+            std::vector<std::thread> pool;
+            pool.reserve(workers - 1);
+            for (int w = 1; w < workers; w++) {
+                pool.emplace_back(task, w);
+            }
+            task(0);
+            for (std::thread& worker : pool) {
+                worker.join();
+            }
+        }
+
+        // Reusable barrier for a fixed set of workers: the last one to arrive runs the
+        // completion step (while the others wait), then all of them move on together
+        class Barrier {
+            private:
+                std::mutex mutex;
+                std::condition_variable released;
+                int count; // workers taking part
+                int waiting; // workers that arrived in the current phase
+                unsigned phase; // incremented each time the barrier opens
+
+            public:
+                explicit Barrier(int count) : count(count), waiting(0), phase(0) {}
+
+                template<typename Completion>
+                void arriveAndWait(Completion completion) {
+                    std::unique_lock<std::mutex> lock(mutex);
+                    unsigned arrivedIn = phase;
+                    if (++waiting == count) {
+                        completion();
+                        waiting = 0;
+                        phase++;
+                        released.notify_all();
+                        return;
+                    }
+                    released.wait(lock, [&]() { return phase != arrivedIn; });
+                }
+        };
+
+        // A slice of a two-run merge: merges src[aLo, aHi) and src[bLo, bHi) into dst[out, ...)
+        struct MergeTask {
+            int aLo, aHi, bLo, bHi, out;
+        };
+    }
+
+    template<typename T, typename GrowthPolicy, typename Allocator>
+    void Array<T, GrowthPolicy, Allocator>::parallelSort(int threads) {
+        /*
+        Algorithm for parallel sort (parallel merge sort):
+            1. threads <= 0 means one worker per hardware thread; cap the worker
+               count so that every chunk holds at least PARALLEL_SORT_MIN_CHUNK elements
+            2. below PARALLEL_SORT_THRESHOLD elements (or with a single worker),
+               fall back to the serial quickSort()
+            3. start the workers once; split the array into one chunk per worker
+               and sort each chunk with the serial introsort in parallel
+            4. merge adjacent sorted runs pairwise, ping-ponging between elements
+               and a scratch buffer, until a single run is left:
+                a. each pairwise merge is split across threads / pairs workers
+                   using merge path: a binary search on each output diagonal
+                   finds how many elements come from each run
+                b. ties take the element from the left run, so merging is stable
+                c. the same workers run every round: a barrier separates the rounds
+                   and the last worker to reach it plans the next one
+            5. if the final run ended up in the scratch buffer, move it back
+        */
+        if (threads <= 0) {
+            threads = std::max(1, static_cast<int>(std::thread::hardware_concurrency()));
+        }
+        threads = std::min(threads, size / PARALLEL_SORT_MIN_CHUNK);
+        if (size < PARALLEL_SORT_THRESHOLD || threads < 2) {
+            quickSort();
+            return;
+        }
+
+        // 3. one chunk per worker
+        std::vector<int> bounds(threads + 1);
+        for (int w = 0; w <= threads; w++) {
+            bounds[w] = static_cast<int>(static_cast<long long>(size) * w / threads);
+        }
+
+        // 4. pairwise merge rounds, planned by the last worker to reach the barrier
+        T* scratch = allocate(size);
+        // after step 3 the sorted runs live in scratch and elements holds moved-from elements
+        T* src = scratch;
+        T* dst = elements;
+        std::vector<detail::MergeTask> tasks;
+        std::vector<int> nextBounds;
+        bool finished = false;
+        auto planRound = [&]() {
+            if (!tasks.empty()) {
+                // the round that just ended merged src into dst
+                std::swap(src, dst);
+                bounds.swap(nextBounds);
+                tasks.clear();
+            }
+            if (bounds.size() <= 2) {
+                finished = true;
+                return;
+            }
+            int runs = static_cast<int>(bounds.size()) - 1;
+            int pairs = runs / 2;
+            int slicesPerPair = std::max(1, threads / pairs);
+
+            nextBounds.clear();
+            nextBounds.push_back(0);
+            for (int p = 0; p < pairs; p++) {
+                int aLo = bounds[2 * p], aHi = bounds[2 * p + 1], bHi = bounds[2 * p + 2];
+                int lenA = aHi - aLo, lenB = bHi - aHi;
+                int total = lenA + lenB;
+
+                // 4a. split the merge of this pair along merge path diagonals
+                int prevI = 0;
+                for (int slice = 1; slice <= slicesPerPair; slice++) {
+                    int diag = static_cast<int>(static_cast<long long>(total) * slice / slicesPerPair);
+                    int lo = std::max(0, diag - lenB);
+                    int hi = std::min(diag, lenA);
+                    while (lo < hi) {
+                        int mid = lo + (hi - lo) / 2;
+                        if (src[aHi + diag - mid - 1] < src[aLo + mid]) {
+                            hi = mid;
+                        } else {
+                            lo = mid + 1;
+                        }
+                    }
+                    int prevDiag = static_cast<int>(static_cast<long long>(total) * (slice - 1) / slicesPerPair);
+                    tasks.push_back({aLo + prevI, aLo + lo, aHi + (prevDiag - prevI), aHi + (diag - lo), aLo + prevDiag});
+                    prevI = lo;
+                }
+                nextBounds.push_back(bHi);
+            }
+            if (runs % 2 == 1) {
+                // odd run out: copied across unchanged
+                tasks.push_back({bounds[runs - 1], bounds[runs], bounds[runs], bounds[runs], bounds[runs - 1]});
+                nextBounds.push_back(bounds[runs]);
+            }
+        };
+
+        // the threads are started once and stay for every round
+        detail::Barrier barrier(threads);
+        detail::runWorkers(threads, [&](int w) {
+            sortRange(bounds[w], bounds[w + 1] - 1);
+            for (int i = bounds[w]; i < bounds[w + 1]; i++) {
+                new (&scratch[i]) T(std::move(elements[i]));
+            }
+            barrier.arriveAndWait(planRound);
+
+            while (!finished) {
+                for (size_t t = w; t < tasks.size(); t += threads) {
+                    const detail::MergeTask& task = tasks[t];
+                    int a = task.aLo, b = task.bLo, out = task.out;
+                    while (a < task.aHi && b < task.bHi) {
+                        // 4b. take from the right run only when strictly smaller
+                        if (src[b] < src[a]) {
+                            dst[out++] = std::move(src[b++]);
+                        } else {
+                            dst[out++] = std::move(src[a++]);
+                        }
+                    }
+                    while (a < task.aHi) { dst[out++] = std::move(src[a++]); }
+                    while (b < task.bHi) { dst[out++] = std::move(src[b++]); }
+                }
+                barrier.arriveAndWait(planRound);
+            }
+
+            // 5. the sorted result must end up in elements
+            if (src != elements) {
+                int from = static_cast<int>(static_cast<long long>(size) * w / threads);
+                int to = static_cast<int>(static_cast<long long>(size) * (w + 1) / threads);
+                for (int i = from; i < to; i++) {
+                    elements[i] = std::move(scratch[i]);
+                }
+            }
+        });
+        if constexpr (!std::is_trivially_destructible<T>::value) {
+            for (int i = 0; i < size; i++) {
+                scratch[i].~T();
+            }
+        }
+        deallocate(scratch, size);
+    }
+
+    namespace detail {
+        // Unsigned integer with the same width as T, used as the radix sort key
+        template<typename T>
+        using RadixKey = typename std::conditional<sizeof(T) == 1, std::uint8_t,
+                         typename std::conditional<sizeof(T) == 2, std::uint16_t,
+                         typename std::conditional<sizeof(T) == 4, std::uint32_t, std::uint64_t>::type>::type>::type;
+
+        template<typename T>
+        RadixKey<T> toRadixKey(T value) {
+            /*
+            Maps value onto an unsigned key whose unsigned order matches the order of T:
+                -> unsigned integers: the bits as they are
+                -> signed integers: flip the sign bit so negatives sort first
+                -> floating point: negative values flip all bits (larger magnitude sorts first),
+                   non-negative values flip only the sign bit
+            */
+            using Key = RadixKey<T>;
+            const Key signBit = static_cast<Key>(Key(1) << (sizeof(Key) * 8 - 1));
+            Key bits;
+            std::memcpy(&bits, &value, sizeof(Key));
+            if constexpr (std::is_floating_point<T>::value) {
+                return (bits & signBit) ? static_cast<Key>(~bits) : static_cast<Key>(bits ^ signBit);
+            } else if constexpr (std::is_signed<T>::value) {
+                return static_cast<Key>(bits ^ signBit);
+            } else {
+                return bits;
+            }
+        }
+
+        template<typename T>
+        T fromRadixKey(RadixKey<T> key) {
+            // inverse of toRadixKey
+            using Key = RadixKey<T>;
+            const Key signBit = static_cast<Key>(Key(1) << (sizeof(Key) * 8 - 1));
+            Key bits;
+            if constexpr (std::is_floating_point<T>::value) {
+                bits = (key & signBit) ? static_cast<Key>(key ^ signBit) : static_cast<Key>(~key);
+            } else if constexpr (std::is_signed<T>::value) {
+                bits = static_cast<Key>(key ^ signBit);
+            } else {
+                bits = key;
+            }
+            T value;
+            std::memcpy(&value, &bits, sizeof(Key));
+            return value;
+        }
+    }
+
+    template<typename T, typename GrowthPolicy, typename Allocator>
+    void Array<T, GrowthPolicy, Allocator>::radixSort() {
+        /*
+        Algorithm for LSD radix sort (integral and floating-point T):
+            1. transform every element into an unsigned key (toRadixKey) and, in the
+               same pass, build a 256-bucket histogram for every 8-bit digit of the key
+            2. for each digit from least to most significant:
+                a. if one bucket holds every element, the digit is constant across
+                   the input and the pass is skipped
+                b. prefix-sum the histogram into bucket offsets
+                c. scatter the keys into the other buffer in stable order
+            3. transform the keys back into values (fromRadixKey)
+            -> any other T falls back to quickSort()
+            -> Time Complexity: O(n * sizeof(T)), Space Complexity: O(n)
+        */
+        if constexpr (std::is_arithmetic<T>::value && sizeof(T) <= 8) {
+            if (size < 2) {
+                return;
+            }
+            using Key = detail::RadixKey<T>;
+            constexpr int DIGITS = static_cast<int>(sizeof(Key));
+            constexpr int BUCKETS = 256;
+
+            std::vector<Key> keys(size);
+            std::vector<Key> buffer(size);
+            std::vector<int> counts(DIGITS * BUCKETS, 0);
+
+            // 1. key transform + histogram pre-pass
+            for (int i = 0; i < size; i++) {
+                Key key = detail::toRadixKey(elements[i]);
+                keys[i] = key;
+                for (int d = 0; d < DIGITS; d++) {
+                    counts[d * BUCKETS + ((key >> (8 * d)) & 0xFF)]++;
+                }
+            }
+
+            // 2. one stable scatter per non-constant digit
+            Key* src = keys.data();
+            Key* dst = buffer.data();
+            for (int d = 0; d < DIGITS; d++) {
+                int* histogram = &counts[d * BUCKETS];
+                bool constantDigit = false;
+                for (int b = 0; b < BUCKETS; b++) {
+                    if (histogram[b] == size) {
+                        constantDigit = true;
+                        break;
+                    }
+                }
+                if (constantDigit) {
+                    continue;
+                }
+
+                int offset = 0;
+                for (int b = 0; b < BUCKETS; b++) {
+                    int bucketSize = histogram[b];
+                    histogram[b] = offset;
+                    offset += bucketSize;
+                }
+                for (int i = 0; i < size; i++) {
+                    Key key = src[i];
+                    dst[histogram[(key >> (8 * d)) & 0xFF]++] = key;
+                }
+                std::swap(src, dst);
+            }
+
+            // 3. inverse key transform
+            for (int i = 0; i < size; i++) {
+                elements[i] = detail::fromRadixKey<T>(src[i]);
+            }
+        } else {
+            quickSort();
+        }
+    }
+
+    template<typename T, typename GrowthPolicy, typename Allocator>
+    void Array<T, GrowthPolicy, Allocator>::reverse() {
+        /*
+        Algorithm to reverse the array in place:
+            1. set left = 0, right = size - 1
+            2. while left < right:
+                a. swap elements[left] and elements[right] (by moves, no copies)
+                b. increment left, decrement right
+        */
+       int left = 0;
+       int right = size - 1;
+       while (left < right) {
+        std::swap(elements[left], elements[right]);
+        left++;
+        right--;
+       }
+    }
+
+    template<typename T, typename GrowthPolicy, typename Allocator>
+    int Array<T, GrowthPolicy, Allocator>::getSize() const {
+        return size;
+    }
+
+    template<typename T, typename GrowthPolicy, typename Allocator>
+    int Array<T, GrowthPolicy, Allocator>::getCapacity() const {
+        return capacity;
+    }
+
+    template<typename T, typename GrowthPolicy, typename Allocator>
+    void Array<T, GrowthPolicy, Allocator>::reserve(int newCapacity) {
+        /*
+        Algorithm to reserve capacity:
+            1. if newCapacity <= capacity, do nothing (reserve never shrinks)
+            2. otherwise resize to exactly newCapacity slots, so filling the
+               array up to newCapacity elements causes no further reallocation
+        */
+        if (newCapacity > capacity) {
+            resize(newCapacity);
+        }
+    }
+
+    template<typename T, typename GrowthPolicy, typename Allocator>
+    void Array<T, GrowthPolicy, Allocator>::shrinkToFit() {
+        // moves the elements into a buffer of exactly size slots
+        if (capacity > size) {
+            resize(size);
+        }
+    }
+
+    template<typename T, typename GrowthPolicy, typename Allocator>
+    bool Array<T, GrowthPolicy, Allocator>::isEmpty() const {
+        return size == 0;
+    }
+
+    template<typename T, typename GrowthPolicy, typename Allocator>
+    Allocator Array<T, GrowthPolicy, Allocator>::getAllocator() const {
+        return allocator;
+    }
+
+    template<typename T, typename GrowthPolicy, typename Allocator>
+    T* Array<T, GrowthPolicy, Allocator>::begin() { return elements; }
+
+    template<typename T, typename GrowthPolicy, typename Allocator>
+    const T* Array<T, GrowthPolicy, Allocator>::begin() const { return elements; }
+
+    template<typename T, typename GrowthPolicy, typename Allocator>
+    T* Array<T, GrowthPolicy, Allocator>::end() { return elements + size; }
+
+    template<typename T, typename GrowthPolicy, typename Allocator>
+    const T* Array<T, GrowthPolicy, Allocator>::end() const { return elements + size; }
+
+    template<typename T, typename GrowthPolicy, typename Allocator>
+    T* Array<T, GrowthPolicy, Allocator>::data() { return elements; }
+
+    template<typename T, typename GrowthPolicy, typename Allocator>
+    const T* Array<T, GrowthPolicy, Allocator>::data() const { return elements; }
+
+    template<typename T, typename GrowthPolicy, typename Allocator>
+    ArrayView<T> Array<T, GrowthPolicy, Allocator>::view() {
+        return ArrayView<T>(elements, size);
+    }
+
+    template<typename T, typename GrowthPolicy, typename Allocator>
+    ArrayView<const T> Array<T, GrowthPolicy, Allocator>::view() const {
+        return ArrayView<const T>(elements, size);
+    }
+
+    template<typename T, typename GrowthPolicy, typename Allocator>
+    ArrayView<T> Array<T, GrowthPolicy, Allocator>::view(int offset, int count) {
+        return view().subview(offset, count);
+    }
+
+    template<typename T, typename GrowthPolicy, typename Allocator>
+    ArrayView<const T> Array<T, GrowthPolicy, Allocator>::view(int offset, int count) const {
+        return view().subview(offset, count);
+    }
+
+    template<typename T, typename GrowthPolicy, typename Allocator>
+    void Array<T, GrowthPolicy, Allocator>::print() {
+        std::cout << "Array [size: " << size << ", capacity: " << capacity << "]: ";
+        for (int i = 0; i < size; i++) {
+            std::cout << elements[i] << " ";
+        }
+        std::cout << std::endl;
+    }
+}
\ No newline at end of file
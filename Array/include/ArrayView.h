@@ -0,0 +1,43 @@
+#pragma once
+#include <type_traits>
+
+namespace dsa {
+    /*
+    Non-owning view of a contiguous run of elements (an Array, a slice of one,
+    or any T* buffer). Copying a view copies two words and never allocates.
+    Use ArrayView<const T> for read-only access. A view is invalidated by
+    anything that reallocates or shrinks the storage it points into.
+    */
+    template<typename T>
+    class ArrayView {
+        private:
+            T* elements; // first element of the view (not owned)
+            int size; // number of elements in the view
+
+        public:
+            ArrayView(); // Empty view
+            ArrayView(T* elements, int size); // View over elements[0, size)
+            template<typename U, typename = typename std::enable_if<std::is_convertible<U(*)[], T(*)[]>::value>::type>
+            ArrayView(const ArrayView<U>& other); // ArrayView<T> -> ArrayView<const T>
+
+            // element access
+            T& operator[](int index) const; // Returns a reference to the element at specified index (unchecked)
+            T& at(int index) const; // Returns a reference to the element at specified index (bounds checked)
+            T* data() const; // Returns a pointer to the first element
+
+            // iteration (contiguous iterators: plain pointers)
+            T* begin() const; // Returns a pointer to the first element
+            T* end() const; // Returns a pointer one past the last element
+
+            // slicing
+            ArrayView subview(int offset, int count) const; // Returns the view of elements [offset, offset + count)
+            ArrayView first(int count) const; // Returns the view of the first count elements
+            ArrayView last(int count) const; // Returns the view of the last count elements
+
+            // utility methods
+            int getSize() const; // Returns the number of elements in the view
+            bool isEmpty() const; // Returns true if the view is empty, false otherwise
+    };
+}
+
+#include "ArrayView.tpp"
\ No newline at end of file
@@ -0,0 +1,61 @@
+#pragma once
+// Template definitions for ArrayView.h (included at the end of ArrayView.h)
+#include <stdexcept>
+
+namespace dsa {
+    template<typename T>
+    ArrayView<T>::ArrayView() : elements(nullptr), size(0) {}
+
+    template<typename T>
+    ArrayView<T>::ArrayView(T* elements, int size) : elements(elements), size(size) {}
+
+    template<typename T>
+    template<typename U, typename>
+    ArrayView<T>::ArrayView(const ArrayView<U>& other) : elements(other.data()), size(other.getSize()) {}
+
+    template<typename T>
+    T& ArrayView<T>::operator[](int index) const {
+        return elements[index];
+    }
+
+    template<typename T>
+    T& ArrayView<T>::at(int index) const {
+        if (index < 0 || index >= size) {
+            throw std::out_of_range("Invalid index");
+        }
+        return elements[index];
+    }
+
+    template<typename T>
+    T* ArrayView<T>::data() const { return elements; }
+
+    template<typename T>
+    T* ArrayView<T>::begin() const { return elements; }
+
+    template<typename T>
+    T* ArrayView<T>::end() const { return elements + size; }
+
+    template<typename T>
+    ArrayView<T> ArrayView<T>::subview(int offset, int count) const {
+        if (offset < 0 || count < 0 || offset + count > size) {
+            throw std::out_of_range("Invalid range");
+        }
+        return ArrayView(elements + offset, count);
+    }
+
+    template<typename T>
+    ArrayView<T> ArrayView<T>::first(int count) const {
+        return subview(0, count);
+    }
+
+    template<typename T>
+    ArrayView<T> ArrayView<T>::last(int count) const {
+        return subview(size - count, count);
+    }
+
+    template<typename T>
+    int ArrayView<T>::getSize() const { return size; }
+
+    template<typename T>
+    bool ArrayView<T>::isEmpty() const { return size == 0; }
+}
\ No newline at end of file
@@ -0,0 +1,45 @@
+#pragma once
+#include "Array.h"
+#include <vector>
+
+namespace dsa {
+    /*
+    Read-only search index over a sorted Array, stored in Eytzinger (BFS) order:
+    the root at slot 1 and the children of slot k at 2k and 2k + 1. The first
+    levels of the implicit tree share a handful of cache lines, and the descendants
+    four levels down from any node are contiguous, so they can be prefetched ahead
+    of the search. The index is a snapshot: rebuild it after the Array changes.
+    */
+    template<typename T>
+    class EytzingerIndex {
+        private:
+            static constexpr int BATCH_SEARCH_GROUP = 16; // lookups interleaved per group in batchSearch
+
+            std::vector<T> tree; // values in BFS order, slot 0 unused
+            std::vector<int> ranks; // ranks[k] = index in the source Array of tree[k]
+            int size; // number of indexed elements
+
+            int build(const Array<T>& sorted, int next, int k); // in-order fill of the subtree rooted at k
+            int resolve(int k, const T& value) const; // maps a finished descent back to an Array index or -1
+
+        public:
+            EytzingerIndex(const Array<T>& sorted); // Builds the index from an Array sorted in ascending order
+
+            int search(const T& value) const; // Returns index (in the source Array) of the found element or -1 if not found
+            void batchSearch(const T* values, int count, int* results) const; // search for many values, results[i] = index or -1
+            int getSize() const; // Returns the number of indexed elements
+    };
+}
+
+#include "EytzingerIndex.tpp"
+
+#ifdef DSA_EXPLICIT_INSTANTIATION
+#include <string>
+
+// Instantiated once in src/EytzingerIndex.cpp instead of in every translation unit
+extern template class dsa::EytzingerIndex<int>;
+extern template class dsa::EytzingerIndex<float>;
+extern template class dsa::EytzingerIndex<double>;
+extern template class dsa::EytzingerIndex<char>;
+extern template class dsa::EytzingerIndex<std::string>;
+#endif
\ No newline at end of file
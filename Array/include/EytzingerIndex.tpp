@@ -0,0 +1,101 @@
+#pragma once
+// Template definitions for EytzingerIndex.h (included at the end of EytzingerIndex.h)
+#include <algorithm> // DSA_PREFETCH comes from Array.tpp
+
+namespace dsa {
+    template<typename T>
+    EytzingerIndex<T>::EytzingerIndex(const Array<T>& sorted) {
+        /*
+        Algorithm to build the index:
+            1. allocate size + 1 slots (slot 0 is unused so children of k are 2k, 2k + 1)
+            2. walk the implicit tree in order; the in-order walk visits the slots in
+               ascending key order, so it consumes the sorted Array from left to right
+            3. remember the source index of every slot in ranks
+        */
+        size = sorted.getSize();
+        tree.resize(size + 1);
+        ranks.resize(size + 1);
+        build(sorted, 0, 1);
+    }
+
+    template<typename T>
+    int EytzingerIndex<T>::build(const Array<T>& sorted, int next, int k) {
+        if (k <= size) {
+            next = build(sorted, next, 2 * k);
+            tree[k] = sorted.get(next);
+            ranks[k] = next;
+            next++;
+            next = build(sorted, next, 2 * k + 1);
+        }
+        return next;
+    }
+
+    template<typename T>
+    int EytzingerIndex<T>::resolve(int k, const T& value) const {
+        /*
+        After the descent, k encodes the path taken: every trailing 1 bit is a
+        step right (tree[k] < value). Dropping those bits and one more 0 bit
+        returns to the last node where the search went left, i.e. the first
+        element >= value. k == 0 means every element is < value.
+        */
+        while (k & 1) {
+            k >>= 1;
+        }
+        k >>= 1;
+        return (k != 0 && tree[k] == value) ? ranks[k] : -1;
+    }
+
+    template<typename T>
+    int EytzingerIndex<T>::search(const T& value) const {
+        /*
+        Algorithm to search the index:
+            1. start at the root, k = 1
+            2. while k is inside the tree:
+                a. prefetch the descendants four levels below k (contiguous slots)
+                b. k = 2k + (tree[k] < value), a branchless step left or right
+            3. resolve k back to the lower bound and compare it with value
+        */
+        int k = 1;
+        while (k <= size) {
+            DSA_PREFETCH(tree.data() + std::min(size, 16 * k));
+            k = 2 * k + (tree[k] < value);
+        }
+        return resolve(k, value);
+    }
+
+    template<typename T>
+    void EytzingerIndex<T>::batchSearch(const T* values, int count, int* results) const {
+        /*
+        Algorithm for batched search:
+            1. take the queries in groups of BATCH_SEARCH_GROUP
+            2. advance every query in the group by one tree level before moving to
+               the next level, so the cache misses of the whole group overlap
+            3. resolve every query as in search()
+        */
+        int slots[BATCH_SEARCH_GROUP];
+        for (int first = 0; first < count; first += BATCH_SEARCH_GROUP) {
+            int group = std::min(BATCH_SEARCH_GROUP, count - first);
+            for (int j = 0; j < group; j++) {
+                slots[j] = 1;
+            }
+            bool descending = true;
+            while (descending) {
+                descending = false;
+                for (int j = 0; j < group; j++) {
+                    int k = slots[j];
+                    if (k <= size) {
+                        DSA_PREFETCH(tree.data() + std::min(size, 16 * k));
+                        slots[j] = 2 * k + (tree[k] < values[first + j]);
+                        descending = true;
+                    }
+                }
+            }
+            for (int j = 0; j < group; j++) {
+                results[first + j] = resolve(slots[j], values[first + j]);
+            }
+        }
+    }
+
+    template<typename T>
+    int EytzingerIndex<T>::getSize() const { return size; }
+}
\ No newline at end of file
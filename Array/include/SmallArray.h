@@ -0,0 +1,85 @@
+#pragma once
+#include "Array.h"
+#include <memory>
+#include <type_traits>
+
+namespace dsa {
+    namespace detail {
+        // Raw, suitably aligned storage for N elements. It is a separate base class
+        // so it is constructed before (and destroyed after) the Array pointing into it.
+        template<typename T, int N>
+        struct InlineBuffer {
+            alignas(T) unsigned char bytes[N * sizeof(T)];
+
+            T* slots() { return reinterpret_cast<T*>(bytes); }
+            const T* slots() const { return reinterpret_cast<const T*>(bytes); }
+        };
+    }
+
+    /*
+    Array with a small-buffer optimization: the first N elements are stored
+    inline, inside the object, and the heap is only touched once the array
+    grows past N. It has the full Array API, but is not an Array: the base is
+    protected so that an inline SmallArray cannot be sliced into (or moved
+    into) a plain Array, which would have to allocate inside a noexcept move.
+    Use view() to hand the elements to code that takes a slice. Allocator is
+    only used once the elements spill past N.
+    */
+    template<typename T, int N, typename GrowthPolicy = DoublingGrowth, typename Allocator = MallocAllocator<T>>
+    class SmallArray : private detail::InlineBuffer<T, N>, protected Array<T, GrowthPolicy, Allocator> {
+        static_assert(N > 0, "SmallArray needs at least one inline slot");
+
+        private:
+            using Base = Array<T, GrowthPolicy, Allocator>;
+
+        public:
+            SmallArray(); // Constructor, capacity N without allocating
+            explicit SmallArray(const Allocator& allocator); // Constructor, spills to memory from allocator past N
+            explicit SmallArray(int initialCapacity); // Constructor, spills to the heap only if initialCapacity > N
+            SmallArray(const SmallArray& other); // Copy constructor (deep copy)
+            SmallArray(SmallArray&& other) noexcept(std::is_nothrow_move_constructible<T>::value); // Move constructor, leaves other empty
+            SmallArray& operator=(const SmallArray& other); // Copy assignment (deep copy)
+            SmallArray& operator=(SmallArray&& other) noexcept(std::is_nothrow_move_constructible<T>::value
+                && std::allocator_traits<Allocator>::is_always_equal::value); // Move assignment, leaves other empty
+            void swap(SmallArray& other); // Exchanges the contents, moves element-wise if either side is inline (may throw)
+
+            bool isInline() const; // Returns true if the elements are still stored inline
+            static constexpr int inlineSlots() { return N; } // Number of elements stored without allocating
+
+            // the Array API
+            using Base::push;
+            using Base::emplaceBack;
+            using Base::pop;
+            using Base::insert;
+            using Base::remove;
+            using Base::insertRange;
+            using Base::removeRange;
+            using Base::append;
+            using Base::get;
+            using Base::set;
+            using Base::at;
+            using Base::operator[];
+            using Base::linearSearch;
+            using Base::binarySearch;
+            using Base::batchSearch;
+            using Base::bubbleSort;
+            using Base::insertionSort;
+            using Base::quickSort;
+            using Base::parallelSort;
+            using Base::radixSort;
+            using Base::getSize;
+            using Base::getCapacity;
+            using Base::reserve;
+            using Base::shrinkToFit;
+            using Base::isEmpty;
+            using Base::getAllocator;
+            using Base::begin;
+            using Base::end;
+            using Base::data;
+            using Base::view;
+            using Base::reverse;
+            using Base::print;
+    };
+}
+
+#include "SmallArray.tpp"
\ No newline at end of file
@@ -0,0 +1,78 @@
+#pragma once
+// Template definitions for SmallArray.h (included at the end of SmallArray.h)
+#include <memory>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+
+namespace dsa {
+    template<typename T, int N, typename GrowthPolicy, typename Allocator>
+    SmallArray<T, N, GrowthPolicy, Allocator>::SmallArray()
+        : detail::InlineBuffer<T, N>(), Array<T, GrowthPolicy, Allocator>(this->slots(), N, Allocator()) {}
+
+    template<typename T, int N, typename GrowthPolicy, typename Allocator>
+    SmallArray<T, N, GrowthPolicy, Allocator>::SmallArray(const Allocator& allocator)
+        : detail::InlineBuffer<T, N>(), Array<T, GrowthPolicy, Allocator>(this->slots(), N, allocator) {}
+
+    template<typename T, int N, typename GrowthPolicy, typename Allocator>
+    SmallArray<T, N, GrowthPolicy, Allocator>::SmallArray(int initialCapacity)
+        : detail::InlineBuffer<T, N>(), Array<T, GrowthPolicy, Allocator>(this->slots(), N, Allocator()) {
+        if (initialCapacity < 0) {
+            throw std::invalid_argument("Invalid capacity");
+        }
+        this->reserve(initialCapacity);
+    }
+
+    template<typename T, int N, typename GrowthPolicy, typename Allocator>
+    SmallArray<T, N, GrowthPolicy, Allocator>::SmallArray(const SmallArray& other)
+        : detail::InlineBuffer<T, N>(), Array<T, GrowthPolicy, Allocator>(this->slots(), N,
+            std::allocator_traits<Allocator>::select_on_container_copy_construction(other.getAllocator())) {
+        // copies into the inline buffer when other's elements fit
+        Array<T, GrowthPolicy, Allocator>::operator=(other);
+    }
+
+    template<typename T, int N, typename GrowthPolicy, typename Allocator>
+    SmallArray<T, N, GrowthPolicy, Allocator>::SmallArray(SmallArray&& other) noexcept(std::is_nothrow_move_constructible<T>::value)
+        : detail::InlineBuffer<T, N>(), Array<T, GrowthPolicy, Allocator>(this->slots(), N, other.getAllocator()) {
+        // steals other's heap block (the allocators are equal), or moves the elements out of
+        // other's inline buffer into this one, which always has room for them
+        this->moveFrom(other);
+    }
+
+    template<typename T, int N, typename GrowthPolicy, typename Allocator>
+    SmallArray<T, N, GrowthPolicy, Allocator>& SmallArray<T, N, GrowthPolicy, Allocator>::operator=(const SmallArray& other) {
+        Array<T, GrowthPolicy, Allocator>::operator=(other);
+        return *this;
+    }
+
+    template<typename T, int N, typename GrowthPolicy, typename Allocator>
+    SmallArray<T, N, GrowthPolicy, Allocator>& SmallArray<T, N, GrowthPolicy, Allocator>::operator=(SmallArray&& other)
+        noexcept(std::is_nothrow_move_constructible<T>::value && std::allocator_traits<Allocator>::is_always_equal::value) {
+        // an inline other fits in this array's inline buffer (or its larger heap block), so only
+        // a heap other with an unequal allocator needs a new block
+        this->moveFrom(other);
+        return *this;
+    }
+
+    template<typename T, int N, typename GrowthPolicy, typename Allocator>
+    void SmallArray<T, N, GrowthPolicy, Allocator>::swap(SmallArray& other) {
+        /*
+        Algorithm to swap two small arrays:
+            1. both on the heap: Array::swap exchanges the buffers (O(1) with equal allocators)
+            2. otherwise: three moves through a temporary SmallArray, so an inline
+               side is moved into inline storage instead of a new heap block
+        */
+        if (!isInline() && !other.isInline()) {
+            Array<T, GrowthPolicy, Allocator>::swap(other);
+            return;
+        }
+        SmallArray temp(std::move(other));
+        other.moveFrom(*this);
+        this->moveFrom(temp);
+    }
+
+    template<typename T, int N, typename GrowthPolicy, typename Allocator>
+    bool SmallArray<T, N, GrowthPolicy, Allocator>::isInline() const {
+        return this->data() == this->slots();
+    }
+}
\ No newline at end of file
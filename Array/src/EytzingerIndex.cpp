@@ -0,0 +1,11 @@
+// Precompiled instantiations for the DSA_EXPLICIT_INSTANTIATION build.
+// The header-only build does not compile this file.
+#include "EytzingerIndex.h"
+#include <string>
+
+// Explicit template instantiation for common types
+template class dsa::EytzingerIndex<int>;
+template class dsa::EytzingerIndex<float>;
+template class dsa::EytzingerIndex<double>;
+template class dsa::EytzingerIndex<char>;
+template class dsa::EytzingerIndex<std::string>;
\ No newline at end of file
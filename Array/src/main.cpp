@@ -1,5 +1,9 @@
 #include <iostream>
+#include <algorithm>
+#include <numeric>
 #include "Array.h"
+#include "EytzingerIndex.h"
+#include "SmallArray.h"
 
 using namespace dsa;
 using namespace std;
@@ -67,6 +71,15 @@ int main() {
     cout << "Removing element at index " << arr.getSize() - 1 << " (near end): " << arr.remove(arr.getSize() - 1) << endl;
     arr.print();
 
+    int block[] = {70, 71, 72};
+    arr.insertRange(1, block, 3);
+    cout << "After inserting 70, 71, 72 at index 1:" << endl;
+    arr.print();
+
+    arr.removeRange(1, 3);
+    cout << "After removing 3 elements at index 1:" << endl;
+    arr.print();
+
     try {
     cout << "Removing element at invalid index 15 (should throw exception): " << endl;
     cout << arr.remove(15) << endl;
@@ -109,6 +122,14 @@ int main() {
     cout << "Using BinarySearch to locate index of 6 in sorted array: " << sortedArr.binarySearch(6) << endl;
     cout << "Using BinarySearch to locate index of 5 (not present -> should return -1): " << sortedArr.binarySearch(5) << endl;
 
+    int queries[] = {10, 3, 2, 8};
+    int results[4];
+    sortedArr.batchSearch(queries, 4, results);
+    cout << "Using BatchSearch to locate 10, 3, 2, 8: " << results[0] << " " << results[1] << " " << results[2] << " " << results[3] << endl;
+
+    EytzingerIndex<int> index(sortedArr);
+    cout << "Using EytzingerIndex to locate index of 8: " << index.search(8) << endl;
+
     cout << "=== 6. Sorting Algorithms ===" << endl;
 
     arr.bubbleSort();
@@ -123,6 +144,24 @@ int main() {
     cout << "After Quick Sort:" << endl;
     arr.print();
 
+    Array<double> doubleArr = Array<double>();
+    doubleArr.push(3.5);
+    doubleArr.push(-1.25);
+    doubleArr.push(0.0);
+    doubleArr.push(-42.0);
+    doubleArr.push(7.75);
+    doubleArr.radixSort();
+    cout << "After Radix Sort:" << endl;
+    doubleArr.print();
+
+    Array<int> largeArr = Array<int>();
+    for (int i = 0; i < 200000; i++) {
+        largeArr.push((i * 7919) % 200000);
+    }
+    largeArr.parallelSort(4);
+    cout << "After Parallel Sort of " << largeArr.getSize() << " elements, first: " << largeArr.get(0)
+         << ", last: " << largeArr.get(largeArr.getSize() - 1) << endl;
+
     cout << "=== 7. Reverse ===" << endl;
 
     arr.reverse();
@@ -155,5 +194,51 @@ int main() {
     cout << "After pushing multiple elements to test dynamic resizing:" << endl;
     arr.print();
 
+    arr.shrinkToFit();
+    cout << "After shrinkToFit:" << endl;
+    arr.print();
+
+    Array<int, OneAndHalfGrowth> reservedArr(4);
+    reservedArr.reserve(6);
+    for (int i = 0; i < 8; i++) {
+        reservedArr.push(i);
+    }
+    cout << "Array with reserve(6) and 1.5x growth after 8 pushes:" << endl;
+    reservedArr.print();
+    cout << endl;
+
+    // 9. Iterators and views
+    cout << "=== 9. Iterators and Views ===" << endl;
+
+    std::sort(arr.begin(), arr.end(), [](int a, int b) { return a > b; });
+    cout << "After std::sort descending via begin()/end():" << endl;
+    arr.print();
+
+    ArrayView<const int> window = static_cast<const Array<int>&>(arr).view(0, 3);
+    cout << "Sum of the first 3 elements through a view: "
+         << std::accumulate(window.begin(), window.end(), 0) << endl;
+
+    cout << "Range-for over the array:";
+    for (int value : arr) {
+        cout << " " << value;
+    }
+    cout << endl;
+    cout << endl;
+
+    // 10. Small-buffer Array
+    cout << "=== 10. SmallArray ===" << endl;
+
+    SmallArray<int, 4> small;
+    for (int i = 1; i <= 4; i++) {
+        small.push(i * 100);
+    }
+    cout << "4 elements, inline: " << (small.isInline() ? "Yes" : "No") << endl;
+    small.push(500);
+    cout << "5 elements, inline: " << (small.isInline() ? "Yes" : "No") << endl;
+    small.pop();
+    small.shrinkToFit();
+    cout << "After pop + shrinkToFit, inline: " << (small.isInline() ? "Yes" : "No") << endl;
+    small.print();
+
     return 0;
 }
@@ -0,0 +1,106 @@
+#pragma once
+
+namespace dsa {
+    namespace detail {
+        // Stable bottom-up merge sort on a null-terminated chain of nodes, shared by
+        // LinkedList, DoublyLinkedList and SkipList. Nodes are only relinked, never copied.
+        // nextOf(node) returns a reference to the link the sort follows (next, or the
+        // level 0 link of a skip list); any other links are left for the caller to rebuild.
+
+        template<typename Node, typename NextOf>
+        Node* splitChainAfter(Node* start, int length, NextOf nextOf) {
+            /*
+            Algorithm to split a chain:
+                -> Walk length - 1 nodes from start (or until the chain ends)
+                -> Cut the link after that node and return the node that followed it
+                -> Time Complexity: O(length), Space Complexity: O(1)
+            */
+            for (int i = 1; i < length && start != nullptr; i++) {
+                start = nextOf(start);
+            }
+            if (start == nullptr) {
+                return nullptr;
+            }
+            Node* rest = nextOf(start);
+            nextOf(start) = nullptr;
+            return rest;
+        }
+
+        template<typename Node, typename NextOf, typename Compare>
+        Node* mergeChains(Node* left, Node* right, Compare& compare, Node*& last, NextOf nextOf) {
+            /*
+            Algorithm to merge two sorted chains:
+                -> While both chains have nodes, take the right node only if it compares strictly
+                   before the left node, otherwise the left node (this keeps the merge stable),
+                   and link it after the last taken node
+                -> Attach whatever remains of either chain and walk to its end to report the last node
+                -> Time Complexity: O(length of both chains), Space Complexity: O(1)
+            */
+            Node* merged = nullptr;
+            last = nullptr;
+            while (left != nullptr && right != nullptr) {
+                Node* taken;
+                if (compare(right->data, left->data)) {
+                    taken = right;
+                    right = nextOf(right);
+                } else {
+                    taken = left;
+                    left = nextOf(left);
+                }
+                if (last == nullptr) {
+                    merged = taken;
+                } else {
+                    nextOf(last) = taken;
+                }
+                last = taken;
+            }
+            Node* rest = (left != nullptr) ? left : right;
+            if (last == nullptr) {
+                merged = rest;
+            } else {
+                nextOf(last) = rest;
+            }
+            while (rest != nullptr) {
+                last = rest;
+                rest = nextOf(rest);
+            }
+            return merged;
+        }
+
+        template<typename Node, typename NextOf, typename Compare>
+        Node* mergeSortChain(Node* head, int count, Compare& compare, Node*& last, NextOf nextOf) {
+            /*
+            Algorithm for bottom-up merge sort of a chain of count nodes:
+                -> For width = 1, 2, 4, ... while width < count:
+                    -> Cut the chain into consecutive runs of width nodes
+                    -> Merge each pair of neighbouring runs with mergeChains and
+                       append the merged run to the new chain
+                -> Return the first node, last becomes the last node
+                -> Time Complexity: O(n log n), Space Complexity: O(1), stable
+            */
+            last = head;
+            for (int width = 1; width < count; width *= 2) {
+                Node* remaining = head;
+                Node* sortedHead = nullptr;
+                Node* sortedTail = nullptr;
+                while (remaining != nullptr) {
+                    Node* left = remaining;
+                    Node* right = splitChainAfter(left, width, nextOf);
+                    remaining = splitChainAfter(right, width, nextOf);
+
+                    Node* runLast = nullptr;
+                    Node* merged = mergeChains(left, right, compare, runLast, nextOf);
+                    if (sortedTail == nullptr) {
+                        sortedHead = merged;
+                    } else {
+                        nextOf(sortedTail) = merged;
+                    }
+                    sortedTail = runLast;
+                }
+                head = sortedHead;
+                last = sortedTail;
+            }
+            return head;
+        }
+    }
+}
\ No newline at end of file
@@ -0,0 +1,131 @@
+#pragma once
+#include "../../Memory/include/MonotonicArena.h"
+#include "../../Memory/include/SlabPool.h"
+#include <cstddef>
+#include <iterator>
+#include <memory>
+
+namespace dsa {
+    // Doubly linked sibling of LinkedList: every node also links to its predecessor,
+    // which makes removeLast O(1), allows backward iteration and lets get/set/insertAt/
+    // removeAt walk from whichever end is closer. Allocator works as in LinkedList.
+    template<typename T, typename Allocator = PoolAllocator<T>>
+    class DoublyLinkedList {
+        private:
+            struct Node {
+                T data;
+                Node* prev;
+                Node* next;
+                Node(T value) : data(std::move(value)), prev(nullptr), next(nullptr) {}
+            };
+
+            using NodeAllocator = typename std::allocator_traits<Allocator>::template rebind_alloc<Node>;
+            using NodeAllocatorTraits = std::allocator_traits<NodeAllocator>;
+
+            Node* head; // The first node in linked list
+            Node* tail; // The last node in linked list
+            int count; // Number of nodes in linked list
+            NodeAllocator allocator; // Allocates the nodes
+
+            Node* createNode(T value); // Allocates and constructs a node holding value
+            void destroyNode(Node* node); // Destroys and deallocates a node
+            Node* nodeAt(int index) const; // Returns the node at index, walking from the closer end
+            T unlink(Node* node); // Detaches node from the list, destroys it and returns its value
+
+        public:
+            // Bidirectional iterator; Value is T or const T
+            template<typename Value>
+            class Iterator {
+                private:
+                    Node* node; // current node, nullptr for end()
+                    const DoublyLinkedList* list; // owning list, used to step back from end()
+
+                    friend class DoublyLinkedList;
+                    template<typename>
+                    friend class Iterator;
+                    Iterator(Node* node, const DoublyLinkedList* list) : node(node), list(list) {}
+
+                public:
+                    using iterator_category = std::bidirectional_iterator_tag;
+                    using value_type = T;
+                    using difference_type = std::ptrdiff_t;
+                    using pointer = Value*;
+                    using reference = Value&;
+
+                    Iterator() : node(nullptr), list(nullptr) {}
+                    operator Iterator<const T>() const { return Iterator<const T>(node, list); }
+
+                    reference operator*() const { return node->data; }
+                    pointer operator->() const { return &node->data; }
+                    Iterator& operator++() { node = node->next; return *this; }
+                    Iterator operator++(int) { Iterator old = *this; node = node->next; return old; }
+                    Iterator& operator--() { node = (node == nullptr) ? list->tail : node->prev; return *this; }
+                    Iterator operator--(int) { Iterator old = *this; --(*this); return old; }
+                    bool operator==(const Iterator& other) const { return node == other.node; }
+                    bool operator!=(const Iterator& other) const { return node != other.node; }
+            };
+
+            using iterator = Iterator<T>;
+            using const_iterator = Iterator<const T>;
+            using reverse_iterator = std::reverse_iterator<iterator>;
+            using const_reverse_iterator = std::reverse_iterator<const_iterator>;
+
+            // Constructor and destructor
+            DoublyLinkedList(); // Constructor
+            explicit DoublyLinkedList(const Allocator& allocator); // Constructor allocating nodes from allocator
+            DoublyLinkedList(const DoublyLinkedList&) = delete;
+            DoublyLinkedList& operator=(const DoublyLinkedList&) = delete;
+            ~DoublyLinkedList(); // Destructor
+
+            // Core operations
+            void insertAtBeginning(T value); // Inserts element at the beginning of the linked list
+            void insertAtEnd(T value); // Inserts element at the end of linked list
+            void insertAt(int index, T value); // Inserts element at a specified index
+            void set(int index, T value); // Modifies the element at the the specified index
+            T get(int index) const; // Returns the value at the specified index
+
+            // Deletion
+            T removeFirst(); // Returns the deleted value of the head or error for empty linked list
+            T removeLast(); // Returns the deleted value of the tail or error for empty linked list, O(1)
+            T removeAt(int index); // Returns the deleted value of node at the specified index or error for empty linked list
+
+            // Searching
+            int linearSearch(T value) const; // Returns the index of the found element or -1 if not found
+
+            // Sorting
+            void mergeSort(); // Stable O(n log n) sort in ascending order, relinks nodes, O(1) extra space
+            template<typename Compare>
+            void mergeSort(Compare compare); // Stable O(n log n) sort ordered by compare(a, b) ("a before b")
+
+            // Iteration
+            iterator begin(); // Iterator to the first element
+            iterator end(); // Iterator past the last element
+            const_iterator begin() const; // Iterator to the first element
+            const_iterator end() const; // Iterator past the last element
+            reverse_iterator rbegin(); // Reverse iterator to the last element
+            reverse_iterator rend(); // Reverse iterator before the first element
+            const_reverse_iterator rbegin() const; // Reverse iterator to the last element
+            const_reverse_iterator rend() const; // Reverse iterator before the first element
+
+            // Utilities
+            int getSize() const; // Returns the total number of elements in linked list
+            bool isEmpty() const; // Checks whether linked list is empty
+            void reverse(); // Reverses the linked list in place
+            void print() const; // Outputs all the elements in linked list
+            void printReverse() const; // Outputs all the elements in linked list from tail to head
+            Allocator getAllocator() const; // Returns a copy of the allocator
+    };
+}
+
+#include "DoublyLinkedList.tpp"
+
+#ifdef DSA_EXPLICIT_INSTANTIATION
+#include <string>
+
+// Instantiated once in src/DoublyLinkedList.cpp instead of in every translation unit
+extern template class dsa::DoublyLinkedList<int>;
+extern template class dsa::DoublyLinkedList<double>;
+extern template class dsa::DoublyLinkedList<float>;
+extern template class dsa::DoublyLinkedList<char>;
+extern template class dsa::DoublyLinkedList<std::string>;
+#endif
\ No newline at end of file
@@ -0,0 +1,344 @@
+#pragma once
+// Template definitions for DoublyLinkedList.h (included at the end of DoublyLinkedList.h)
+#include "ChainMergeSort.h"
+#include <iostream>
+#include <stdexcept> // For std::out_of_range
+#include <type_traits>
+#include <utility>
+
+namespace dsa {
+    template<typename T, typename Allocator>
+    DoublyLinkedList<T, Allocator>::DoublyLinkedList() : DoublyLinkedList(Allocator()) {}
+
+    template<typename T, typename Allocator>
+    DoublyLinkedList<T, Allocator>::DoublyLinkedList(const Allocator& allocator)
+        : head(nullptr), tail(nullptr), count(0), allocator(allocator) {}
+
+    template<typename T, typename Allocator>
+    DoublyLinkedList<T, Allocator>::~DoublyLinkedList() {
+        /*
+        Algorithm to implement destructor:
+            -> Traverse the linked list and destroy each node
+            -> Monotonic allocators with trivially destructible data: skip the walk, O(1)
+            -> Time Complexity: O(n), Space Complexity: O(1)
+        */
+        if constexpr (!(std::is_trivially_destructible<T>::value && IsMonotonicAllocator<NodeAllocator>::value)) {
+            Node* current = head;
+            while (current != nullptr) {
+                Node* nextNode = current->next;
+                destroyNode(current);
+                current = nextNode;
+            }
+        }
+        head = tail = nullptr;
+        count = 0;
+    }
+
+    template<typename T, typename Allocator>
+    typename DoublyLinkedList<T, Allocator>::Node* DoublyLinkedList<T, Allocator>::createNode(T value) {
+        Node* node = NodeAllocatorTraits::allocate(allocator, 1);
+        try {
+            NodeAllocatorTraits::construct(allocator, node, std::move(value));
+        } catch (...) {
+            NodeAllocatorTraits::deallocate(allocator, node, 1);
+            throw;
+        }
+        return node;
+    }
+
+    template<typename T, typename Allocator>
+    void DoublyLinkedList<T, Allocator>::destroyNode(Node* node) {
+        NodeAllocatorTraits::destroy(allocator, node);
+        NodeAllocatorTraits::deallocate(allocator, node, 1);
+    }
+
+    template<typename T, typename Allocator>
+    typename DoublyLinkedList<T, Allocator>::Node* DoublyLinkedList<T, Allocator>::nodeAt(int index) const {
+        /*
+        Algorithm to find the node at index:
+            -> Check the index is within [0, count)
+            -> If index is in the first half, walk forward from head
+            -> Otherwise walk backward from tail
+            -> Time Complexity: O(min(index, n - index)), Space Complexity: O(1)
+        */
+        if (index < 0 || index >= count) {
+            throw std::out_of_range("Index out of range");
+        }
+        Node* current;
+        if (index < count / 2) {
+            current = head;
+            for (int i = 0; i < index; i++) {
+                current = current->next;
+            }
+        } else {
+            current = tail;
+            for (int i = count - 1; i > index; i--) {
+                current = current->prev;
+            }
+        }
+        return current;
+    }
+
+    template<typename T, typename Allocator>
+    T DoublyLinkedList<T, Allocator>::unlink(Node* node) {
+        /*
+        Algorithm to unlink a node:
+            -> Point the predecessor (or head) past the node
+            -> Point the successor (or tail) back past the node
+            -> Move the value out, destroy the node and decrement the size
+            -> Time Complexity: O(1), Space Complexity: O(1)
+        */
+        if (node->prev != nullptr) {
+            node->prev->next = node->next;
+        } else {
+            head = node->next;
+        }
+        if (node->next != nullptr) {
+            node->next->prev = node->prev;
+        } else {
+            tail = node->prev;
+        }
+        T data = std::move(node->data);
+        destroyNode(node);
+        count--;
+        return data;
+    }
+
+    template<typename T, typename Allocator>
+    void DoublyLinkedList<T, Allocator>::insertAtBeginning(T value) {
+        /*
+        Algorithm to implement insertAtBeginning:
+            -> Create a new node with the given value
+            -> If the linked list is empty, set head and tail to the new node
+            -> Otherwise link the new node and the current head to each other and update head
+            -> Increment the size of the linked list
+            -> Time Complexity: O(1), Space Complexity: O(1)
+        */
+        Node* newNode = createNode(std::move(value));
+        if (head == nullptr) {
+            head = tail = newNode;
+        } else {
+            newNode->next = head;
+            head->prev = newNode;
+            head = newNode;
+        }
+        count++;
+    }
+
+    template<typename T, typename Allocator>
+    void DoublyLinkedList<T, Allocator>::insertAtEnd(T value) {
+        /*
+        Algorithm to insert at the end of the linked list:
+            -> Create a new node with the given value
+            -> If the linked list is empty, set head and tail to the new node
+            -> Otherwise link the current tail and the new node to each other and update tail
+            -> Increment the size of the linked list
+            -> Time Complexity: O(1), Space Complexity: O(1)
+        */
+        Node* newNode = createNode(std::move(value));
+        if (tail == nullptr) {
+            head = tail = newNode;
+        } else {
+            newNode->prev = tail;
+            tail->next = newNode;
+            tail = newNode;
+        }
+        count++;
+    }
+
+    template<typename T, typename Allocator>
+    void DoublyLinkedList<T, Allocator>::insertAt(int index, T value) {
+        /*
+        Algorithm to implement insert at specified index:
+            -> If index is 0 or size, insert at the beginning or end
+            -> Otherwise find the node currently at index (walking from the closer end)
+            -> Link the new node between that node's predecessor and the node itself
+            -> Increment the size of the linked list
+            -> Handle edge cases such as index out of bounds
+            -> Time Complexity: O(min(index, n - index)), Space Complexity: O(1)
+        */
+        if (index < 0 || index > count) {
+            throw std::out_of_range("Index out of bounds");
+        }
+        if (index == 0) {
+            insertAtBeginning(std::move(value));
+            return;
+        }
+        if (index == count) {
+            insertAtEnd(std::move(value));
+            return;
+        }
+        Node* successor = nodeAt(index);
+        Node* newNode = createNode(std::move(value));
+        newNode->prev = successor->prev;
+        newNode->next = successor;
+        successor->prev->next = newNode;
+        successor->prev = newNode;
+        count++;
+    }
+
+    template<typename T, typename Allocator>
+    void DoublyLinkedList<T, Allocator>::set(int index, T value) {
+        // walks from the closer end, Time Complexity: O(min(index, n - index))
+        nodeAt(index)->data = std::move(value);
+    }
+
+    template<typename T, typename Allocator>
+    T DoublyLinkedList<T, Allocator>::get(int index) const {
+        // walks from the closer end, Time Complexity: O(min(index, n - index))
+        return nodeAt(index)->data;
+    }
+
+    template<typename T, typename Allocator>
+    T DoublyLinkedList<T, Allocator>::removeFirst() {
+        if (head == nullptr) {
+            throw std::out_of_range("Cannot delete from empty linked list");
+        }
+        return unlink(head);
+    }
+
+    template<typename T, typename Allocator>
+    T DoublyLinkedList<T, Allocator>::removeLast() {
+        /*
+        Algorithm to implement removeLast:
+            -> Check if the linked list is empty; if so, throw an exception
+            -> The predecessor of tail is tail->prev, so no traversal is needed:
+               unlink tail directly
+            -> Time Complexity: O(1), Space Complexity: O(1)
+        */
+        if (tail == nullptr) {
+            throw std::out_of_range("Cannot delete from empty linked list");
+        }
+        return unlink(tail);
+    }
+
+    template<typename T, typename Allocator>
+    T DoublyLinkedList<T, Allocator>::removeAt(int index) {
+        // finds the node from the closer end, then unlinks it in O(1)
+        if (head == nullptr) {
+            throw std::out_of_range("Cannot delete from empty linked list");
+        }
+        if (index < 0 || index >= count) {
+            throw std::out_of_range("Index out of bounds");
+        }
+        return unlink(nodeAt(index));
+    }
+
+    template<typename T, typename Allocator>
+    int DoublyLinkedList<T, Allocator>::linearSearch(T value) const {
+        int index = 0;
+        for (Node* current = head; current != nullptr; current = current->next) {
+            if (current->data == value) {
+                return index;
+            }
+            index++;
+        }
+        return -1;
+    }
+
+    template<typename T, typename Allocator>
+    void DoublyLinkedList<T, Allocator>::mergeSort() {
+        mergeSort([](const T& a, const T& b) { return a < b; });
+    }
+
+    template<typename T, typename Allocator>
+    template<typename Compare>
+    void DoublyLinkedList<T, Allocator>::mergeSort(Compare compare) {
+        /* Algorithm to implement bottom-up merge sort:
+            -> Sort along the next pointers with detail::mergeSortChain, the stable bottom-up
+               merge sort LinkedList::mergeSort uses (nodes are relinked, never copied)
+            -> The merges ignore prev pointers, so rebuild them (and tail) in one final pass
+            -> Time Complexity: O(n log n), Space Complexity: O(1), stable
+        */
+        if (count < 2) {
+            return;
+        }
+        Node* last = nullptr;
+        head = detail::mergeSortChain(head, count, compare, last, [](Node* node) -> Node*& { return node->next; });
+
+        Node* previous = nullptr;
+        for (Node* current = head; current != nullptr; current = current->next) {
+            current->prev = previous;
+            previous = current;
+        }
+        tail = previous;
+    }
+
+    template<typename T, typename Allocator>
+    typename DoublyLinkedList<T, Allocator>::iterator DoublyLinkedList<T, Allocator>::begin() {
+        return iterator(head, this);
+    }
+
+    template<typename T, typename Allocator>
+    typename DoublyLinkedList<T, Allocator>::iterator DoublyLinkedList<T, Allocator>::end() {
+        return iterator(nullptr, this);
+    }
+
+    template<typename T, typename Allocator>
+    typename DoublyLinkedList<T, Allocator>::const_iterator DoublyLinkedList<T, Allocator>::begin() const {
+        return const_iterator(head, this);
+    }
+
+    template<typename T, typename Allocator>
+    typename DoublyLinkedList<T, Allocator>::const_iterator DoublyLinkedList<T, Allocator>::end() const {
+        return const_iterator(nullptr, this);
+    }
+
+    template<typename T, typename Allocator>
+    typename DoublyLinkedList<T, Allocator>::reverse_iterator DoublyLinkedList<T, Allocator>::rbegin() {
+        return reverse_iterator(end());
+    }
+
+    template<typename T, typename Allocator>
+    typename DoublyLinkedList<T, Allocator>::reverse_iterator DoublyLinkedList<T, Allocator>::rend() {
+        return reverse_iterator(begin());
+    }
+
+    template<typename T, typename Allocator>
+    typename DoublyLinkedList<T, Allocator>::const_reverse_iterator DoublyLinkedList<T, Allocator>::rbegin() const {
+        return const_reverse_iterator(end());
+    }
+
+    template<typename T, typename Allocator>
+    typename DoublyLinkedList<T, Allocator>::const_reverse_iterator DoublyLinkedList<T, Allocator>::rend() const {
+        return const_reverse_iterator(begin());
+    }
+
+    template<typename T, typename Allocator>
+    int DoublyLinkedList<T, Allocator>::getSize() const { return count; }
+
+    template<typename T, typename Allocator>
+    bool DoublyLinkedList<T, Allocator>::isEmpty() const { return count == 0; }
+
+    template<typename T, typename Allocator>
+    void DoublyLinkedList<T, Allocator>::reverse() {
+        /* Algorithm to implement reverse:
+            -> Swap the prev and next pointers of every node
+            -> Swap head and tail
+            -> Time Complexity: O(n), Space Complexity: O(1)
+        */
+        for (Node* current = head; current != nullptr; current = current->prev) {
+            std::swap(current->prev, current->next);
+        }
+        std::swap(head, tail);
+    }
+
+    template<typename T, typename Allocator>
+    void DoublyLinkedList<T, Allocator>::print() const {
+        for (Node* current = head; current != nullptr; current = current->next) {
+            std::cout << current->data << " ";
+        }
+    }
+
+    template<typename T, typename Allocator>
+    void DoublyLinkedList<T, Allocator>::printReverse() const {
+        for (Node* current = tail; current != nullptr; current = current->prev) {
+            std::cout << current->data << " ";
+        }
+    }
+
+    template<typename T, typename Allocator>
+    Allocator DoublyLinkedList<T, Allocator>::getAllocator() const {
+        return Allocator(allocator);
+    }
+}
\ No newline at end of file
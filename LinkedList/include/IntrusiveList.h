@@ -0,0 +1,134 @@
+#pragma once
+#include <cstddef>
+#include <iterator>
+
+namespace dsa {
+    template<typename T>
+    class IntrusiveListHook;
+
+    template<typename T, IntrusiveListHook<T> T::*Hook>
+    class IntrusiveList;
+
+    // Links embedded in an object so that IntrusiveList can chain the object itself.
+    // Copying an object does not copy its list membership: the copy starts unlinked,
+    // and assigning to a linked object keeps it where it is.
+    template<typename T>
+    class IntrusiveListHook {
+        private:
+            T* prev; // previous object in the list
+            T* next; // next object in the list
+            const void* owner; // list the object is linked into, nullptr if none
+
+            template<typename U, IntrusiveListHook<U> U::*Hook>
+            friend class IntrusiveList;
+
+        public:
+            IntrusiveListHook() noexcept : prev(nullptr), next(nullptr), owner(nullptr) {}
+            IntrusiveListHook(const IntrusiveListHook&) noexcept : IntrusiveListHook() {}
+            IntrusiveListHook& operator=(const IntrusiveListHook&) noexcept { return *this; }
+
+            bool isLinked() const noexcept { return owner != nullptr; } // True while the object is in a list
+    };
+
+    // Doubly linked list of objects that carry their own links in a hook member:
+    //
+    //     struct Job { int id; dsa::IntrusiveListHook<Job> hook; };
+    //     dsa::IntrusiveList<Job, &Job::hook> queue;
+    //
+    // The list never allocates, copies or destroys objects; it only links the objects it
+    // is given, so they must outlive their membership (remove them before destroying them).
+    // An object can be in one list per hook member. Since the object is the node, removing
+    // it by reference is O(1).
+    template<typename T, IntrusiveListHook<T> T::*Hook>
+    class IntrusiveList {
+        private:
+            T* head; // The first object in the list
+            T* tail; // The last object in the list
+            int count; // Number of objects in the list
+
+            static IntrusiveListHook<T>& hookOf(T& object); // The object's hook for this list
+            static const IntrusiveListHook<T>& hookOf(const T& object); // The object's hook for this list
+            void link(T& object, T* before); // Links an unlinked object before before (at the end if nullptr)
+            T* objectAt(int index) const; // Returns the object at index, walking from the closer end
+
+        public:
+            // Bidirectional iterator over the linked objects; Value is T or const T
+            template<typename Value>
+            class Iterator {
+                private:
+                    Value* object; // current object, nullptr for end()
+                    const IntrusiveList* list; // owning list, used to step back from end()
+
+                    friend class IntrusiveList;
+                    template<typename>
+                    friend class Iterator;
+                    Iterator(Value* object, const IntrusiveList* list) : object(object), list(list) {}
+
+                public:
+                    using iterator_category = std::bidirectional_iterator_tag;
+                    using value_type = T;
+                    using difference_type = std::ptrdiff_t;
+                    using pointer = Value*;
+                    using reference = Value&;
+
+                    Iterator() : object(nullptr), list(nullptr) {}
+                    operator Iterator<const T>() const { return Iterator<const T>(object, list); }
+
+                    reference operator*() const { return *object; }
+                    pointer operator->() const { return object; }
+                    Iterator& operator++() { object = hookOf(*object).next; return *this; }
+                    Iterator operator++(int) { Iterator old = *this; ++(*this); return old; }
+                    Iterator& operator--() { object = (object == nullptr) ? list->tail : hookOf(*object).prev; return *this; }
+                    Iterator operator--(int) { Iterator old = *this; --(*this); return old; }
+                    bool operator==(const Iterator& other) const { return object == other.object; }
+                    bool operator!=(const Iterator& other) const { return object != other.object; }
+            };
+
+            using iterator = Iterator<T>;
+            using const_iterator = Iterator<const T>;
+            using reverse_iterator = std::reverse_iterator<iterator>;
+            using const_reverse_iterator = std::reverse_iterator<const_iterator>;
+
+            // Constructor and destructor
+            IntrusiveList(); // Constructor
+            IntrusiveList(const IntrusiveList&) = delete;
+            IntrusiveList& operator=(const IntrusiveList&) = delete;
+            ~IntrusiveList(); // Destructor, unlinks every object (the objects themselves are untouched)
+
+            // Core operations (object must not be in a list through this hook already)
+            void insertAtBeginning(T& object); // Links object at the beginning of the list
+            void insertAtEnd(T& object); // Links object at the end of the list
+            void insertAt(int index, T& object); // Links object at a specified index
+            void insertAfter(T& position, T& object); // Links object right after position, which must be in this list
+            T& get(int index) const; // Returns the object at the specified index
+
+            // Deletion (objects are unlinked, not destroyed)
+            T& removeFirst(); // Unlinks and returns the first object or error for empty list
+            T& removeLast(); // Unlinks and returns the last object or error for empty list
+            T& removeAt(int index); // Unlinks and returns the object at the specified index or error for empty list
+            void remove(T& object); // Unlinks object, which must be in this list, in O(1)
+            void clear(); // Unlinks every object
+
+            // Searching
+            bool contains(const T& object) const; // True if this very object is in the list, O(1)
+            int linearSearch(const T& value) const; // Returns the index of the first object equal to value or -1 if not found
+
+            // Iteration
+            iterator begin(); // Iterator to the first object
+            iterator end(); // Iterator past the last object
+            const_iterator begin() const; // Iterator to the first object
+            const_iterator end() const; // Iterator past the last object
+            reverse_iterator rbegin(); // Reverse iterator to the last object
+            reverse_iterator rend(); // Reverse iterator before the first object
+            const_reverse_iterator rbegin() const; // Reverse iterator to the last object
+            const_reverse_iterator rend() const; // Reverse iterator before the first object
+
+            // Utilities
+            int getSize() const; // Returns the number of objects in the list
+            bool isEmpty() const; // Checks whether the list is empty
+            void reverse(); // Reverses the list in place
+            void print() const; // Outputs all the objects in the list (needs operator<< for T)
+    };
+}
+
+#include "IntrusiveList.tpp"
\ No newline at end of file
@@ -0,0 +1,274 @@
+#pragma once
+// Template definitions for IntrusiveList.h (included at the end of IntrusiveList.h)
+#include <iostream>
+#include <stdexcept> // For std::out_of_range, std::invalid_argument
+#include <utility>
+
+namespace dsa {
+    template<typename T, IntrusiveListHook<T> T::*Hook>
+    IntrusiveList<T, Hook>::IntrusiveList() : head(nullptr), tail(nullptr), count(0) {}
+
+    template<typename T, IntrusiveListHook<T> T::*Hook>
+    IntrusiveList<T, Hook>::~IntrusiveList() {
+        clear();
+    }
+
+    template<typename T, IntrusiveListHook<T> T::*Hook>
+    IntrusiveListHook<T>& IntrusiveList<T, Hook>::hookOf(T& object) {
+        return object.*Hook;
+    }
+
+    template<typename T, IntrusiveListHook<T> T::*Hook>
+    const IntrusiveListHook<T>& IntrusiveList<T, Hook>::hookOf(const T& object) {
+        return object.*Hook;
+    }
+
+    template<typename T, IntrusiveListHook<T> T::*Hook>
+    void IntrusiveList<T, Hook>::link(T& object, T* before) {
+        /*
+        Algorithm to link an object:
+            -> Refuse an object that is already linked through this hook (its links are in use)
+            -> The object's hook takes before as next and before's predecessor (or tail, when
+               appending) as prev; the neighbours, or head and tail, point back at the object
+            -> Increment the size of the list
+            -> Time Complexity: O(1), Space Complexity: O(1), nothing is allocated
+        */
+        IntrusiveListHook<T>& hook = hookOf(object);
+        if (hook.owner != nullptr) {
+            throw std::invalid_argument("Object is already in a list");
+        }
+        T* after = (before == nullptr) ? tail : hookOf(*before).prev;
+        hook.prev = after;
+        hook.next = before;
+        hook.owner = this;
+        if (after != nullptr) {
+            hookOf(*after).next = &object;
+        } else {
+            head = &object;
+        }
+        if (before != nullptr) {
+            hookOf(*before).prev = &object;
+        } else {
+            tail = &object;
+        }
+        count++;
+    }
+
+    template<typename T, IntrusiveListHook<T> T::*Hook>
+    T* IntrusiveList<T, Hook>::objectAt(int index) const {
+        /*
+        Algorithm to find the object at index:
+            -> Check the index is within [0, count)
+            -> Walk forward from head in the first half, backward from tail otherwise
+            -> Time Complexity: O(min(index, n - index)), Space Complexity: O(1)
+        */
+        if (index < 0 || index >= count) {
+            throw std::out_of_range("Index out of range");
+        }
+        T* current;
+        if (index < count / 2) {
+            current = head;
+            for (int i = 0; i < index; i++) {
+                current = hookOf(*current).next;
+            }
+        } else {
+            current = tail;
+            for (int i = count - 1; i > index; i--) {
+                current = hookOf(*current).prev;
+            }
+        }
+        return current;
+    }
+
+    template<typename T, IntrusiveListHook<T> T::*Hook>
+    void IntrusiveList<T, Hook>::insertAtBeginning(T& object) {
+        link(object, head);
+    }
+
+    template<typename T, IntrusiveListHook<T> T::*Hook>
+    void IntrusiveList<T, Hook>::insertAtEnd(T& object) {
+        link(object, nullptr);
+    }
+
+    template<typename T, IntrusiveListHook<T> T::*Hook>
+    void IntrusiveList<T, Hook>::insertAt(int index, T& object) {
+        if (index < 0 || index > count) {
+            throw std::out_of_range("Index out of bounds");
+        }
+        link(object, (index == count) ? nullptr : objectAt(index));
+    }
+
+    template<typename T, IntrusiveListHook<T> T::*Hook>
+    void IntrusiveList<T, Hook>::insertAfter(T& position, T& object) {
+        if (hookOf(position).owner != this) {
+            throw std::invalid_argument("Position is not in this list");
+        }
+        link(object, hookOf(position).next);
+    }
+
+    template<typename T, IntrusiveListHook<T> T::*Hook>
+    T& IntrusiveList<T, Hook>::get(int index) const {
+        return *objectAt(index);
+    }
+
+    template<typename T, IntrusiveListHook<T> T::*Hook>
+    T& IntrusiveList<T, Hook>::removeFirst() {
+        if (head == nullptr) {
+            throw std::out_of_range("Cannot delete from empty linked list");
+        }
+        T& object = *head;
+        remove(object);
+        return object;
+    }
+
+    template<typename T, IntrusiveListHook<T> T::*Hook>
+    T& IntrusiveList<T, Hook>::removeLast() {
+        if (tail == nullptr) {
+            throw std::out_of_range("Cannot delete from empty linked list");
+        }
+        T& object = *tail;
+        remove(object);
+        return object;
+    }
+
+    template<typename T, IntrusiveListHook<T> T::*Hook>
+    T& IntrusiveList<T, Hook>::removeAt(int index) {
+        if (head == nullptr) {
+            throw std::out_of_range("Cannot delete from empty linked list");
+        }
+        if (index < 0 || index >= count) {
+            throw std::out_of_range("Index out of bounds");
+        }
+        T& object = *objectAt(index);
+        remove(object);
+        return object;
+    }
+
+    template<typename T, IntrusiveListHook<T> T::*Hook>
+    void IntrusiveList<T, Hook>::remove(T& object) {
+        /*
+        Algorithm to remove an object by reference:
+            -> Check the object is linked into this list (its hook records the owner)
+            -> Point the predecessor (or head) past the object and the successor (or tail) back past it
+            -> Reset the object's hook so it can join a list again, and decrement the size
+            -> Time Complexity: O(1), Space Complexity: O(1), no search and no deallocation
+        */
+        IntrusiveListHook<T>& hook = hookOf(object);
+        if (hook.owner != this) {
+            throw std::invalid_argument("Object is not in this list");
+        }
+        if (hook.prev != nullptr) {
+            hookOf(*hook.prev).next = hook.next;
+        } else {
+            head = hook.next;
+        }
+        if (hook.next != nullptr) {
+            hookOf(*hook.next).prev = hook.prev;
+        } else {
+            tail = hook.prev;
+        }
+        hook.prev = hook.next = nullptr;
+        hook.owner = nullptr;
+        count--;
+    }
+
+    template<typename T, IntrusiveListHook<T> T::*Hook>
+    void IntrusiveList<T, Hook>::clear() {
+        // only the hooks are reset, Time Complexity: O(n)
+        T* current = head;
+        while (current != nullptr) {
+            IntrusiveListHook<T>& hook = hookOf(*current);
+            current = hook.next;
+            hook.prev = hook.next = nullptr;
+            hook.owner = nullptr;
+        }
+        head = tail = nullptr;
+        count = 0;
+    }
+
+    template<typename T, IntrusiveListHook<T> T::*Hook>
+    bool IntrusiveList<T, Hook>::contains(const T& object) const {
+        return hookOf(object).owner == this;
+    }
+
+    template<typename T, IntrusiveListHook<T> T::*Hook>
+    int IntrusiveList<T, Hook>::linearSearch(const T& value) const {
+        int index = 0;
+        for (const T* current = head; current != nullptr; current = hookOf(*current).next) {
+            if (*current == value) {
+                return index;
+            }
+            index++;
+        }
+        return -1;
+    }
+
+    template<typename T, IntrusiveListHook<T> T::*Hook>
+    typename IntrusiveList<T, Hook>::iterator IntrusiveList<T, Hook>::begin() {
+        return iterator(head, this);
+    }
+
+    template<typename T, IntrusiveListHook<T> T::*Hook>
+    typename IntrusiveList<T, Hook>::iterator IntrusiveList<T, Hook>::end() {
+        return iterator(nullptr, this);
+    }
+
+    template<typename T, IntrusiveListHook<T> T::*Hook>
+    typename IntrusiveList<T, Hook>::const_iterator IntrusiveList<T, Hook>::begin() const {
+        return const_iterator(head, this);
+    }
+
+    template<typename T, IntrusiveListHook<T> T::*Hook>
+    typename IntrusiveList<T, Hook>::const_iterator IntrusiveList<T, Hook>::end() const {
+        return const_iterator(nullptr, this);
+    }
+
+    template<typename T, IntrusiveListHook<T> T::*Hook>
+    typename IntrusiveList<T, Hook>::reverse_iterator IntrusiveList<T, Hook>::rbegin() {
+        return reverse_iterator(end());
+    }
+
+    template<typename T, IntrusiveListHook<T> T::*Hook>
+    typename IntrusiveList<T, Hook>::reverse_iterator IntrusiveList<T, Hook>::rend() {
+        return reverse_iterator(begin());
+    }
+
+    template<typename T, IntrusiveListHook<T> T::*Hook>
+    typename IntrusiveList<T, Hook>::const_reverse_iterator IntrusiveList<T, Hook>::rbegin() const {
+        return const_reverse_iterator(end());
+    }
+
+    template<typename T, IntrusiveListHook<T> T::*Hook>
+    typename IntrusiveList<T, Hook>::const_reverse_iterator IntrusiveList<T, Hook>::rend() const {
+        return const_reverse_iterator(begin());
+    }
+
+    template<typename T, IntrusiveListHook<T> T::*Hook>
+    int IntrusiveList<T, Hook>::getSize() const { return count; }
+
+    template<typename T, IntrusiveListHook<T> T::*Hook>
+    bool IntrusiveList<T, Hook>::isEmpty() const { return count == 0; }
+
+    template<typename T, IntrusiveListHook<T> T::*Hook>
+    void IntrusiveList<T, Hook>::reverse() {
+        /* Algorithm to implement reverse:
+            -> Swap prev and next in every object's hook
+            -> Swap head and tail
+            -> Time Complexity: O(n), Space Complexity: O(1)
+        */
+        T* current = head;
+        while (current != nullptr) {
+            IntrusiveListHook<T>& hook = hookOf(*current);
+            std::swap(hook.prev, hook.next);
+            current = hook.prev;
+        }
+        std::swap(head, tail);
+    }
+
+    template<typename T, IntrusiveListHook<T> T::*Hook>
+    void IntrusiveList<T, Hook>::print() const {
+        for (const T* current = head; current != nullptr; current = hookOf(*current).next) {
+            std::cout << *current << " ";
+        }
+    }
+}
\ No newline at end of file
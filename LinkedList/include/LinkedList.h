@@ -1,22 +1,103 @@
 #pragma once
+#include "../../Memory/include/MonotonicArena.h"
+#include "../../Memory/include/SlabPool.h"
+#include <cstddef>
+#include <iterator>
+#include <memory>
 
 namespace dsa {
-    template<typename T>
+    // Allocator is any std::allocator-compatible allocator; it is rebound to allocate
+    // nodes. The default PoolAllocator draws nodes from a slab pool (one per list unless
+    // the allocator is shared), so consecutively inserted nodes are adjacent in memory and
+    // removed nodes are recycled without malloc/free. With an ArenaAllocator the list can
+    // be torn down together with its arena.
+    template<typename T, typename Allocator = PoolAllocator<T>>
     class LinkedList {
         private:
             struct Node {
                 T data;
                 Node* next;
-                Node(T value) : data(value), next(nullptr) {}
+                Node(T value) : data(std::move(value)), next(nullptr) {}
             };
 
+            using NodeAllocator = typename std::allocator_traits<Allocator>::template rebind_alloc<Node>;
+            using NodeAllocatorTraits = std::allocator_traits<NodeAllocator>;
+
             Node* head; // The first node in linked list
             Node* tail; // The last node in linked list
             int count; // Number of nodes in linked list
+            NodeAllocator allocator; // Allocates the nodes
+            Node* finger; // Node that get/set reached last, nullptr when not cached
+            int fingerIndex; // Index of finger
+
+            Node* createNode(T value); // Allocates and constructs a node holding value
+            void destroyNode(Node* node); // Destroys and deallocates a node
+            Node* nodeAt(int index); // Returns the node at index or nullptr, walking from the finger when it is not past index
+            void invalidateFinger(); // Forgets the finger; called by every change that moves nodes to other indices
+            static Node*& nextOf(Node* node); // The link the shared chain merge sort follows
 
         public:
+            // Forward iterator; Value is T or const T
+            template<typename Value>
+            class Iterator {
+                private:
+                    Node* node; // current node, nullptr for end()
+
+                    friend class LinkedList;
+                    template<typename>
+                    friend class Iterator;
+                    explicit Iterator(Node* node) : node(node) {}
+
+                public:
+                    using iterator_category = std::forward_iterator_tag;
+                    using value_type = T;
+                    using difference_type = std::ptrdiff_t;
+                    using pointer = Value*;
+                    using reference = Value&;
+
+                    Iterator() : node(nullptr) {}
+                    operator Iterator<const T>() const { return Iterator<const T>(node); }
+
+                    reference operator*() const { return node->data; }
+                    pointer operator->() const { return &node->data; }
+                    Iterator& operator++() { node = node->next; return *this; }
+                    Iterator operator++(int) { Iterator old = *this; node = node->next; return old; }
+                    bool operator==(const Iterator& other) const { return node == other.node; }
+                    bool operator!=(const Iterator& other) const { return node != other.node; }
+            };
+
+            using iterator = Iterator<T>;
+            using const_iterator = Iterator<const T>;
+
+            // Editing cursor. It sits on an element, or before the first element, and edits
+            // the list right after itself in O(1), so a single pass can insert, erase and
+            // modify elements without restarting from head. Erasing the element a cursor or
+            // iterator sits on invalidates it; nothing else does.
+            class Cursor {
+                private:
+                    LinkedList* list; // list being edited
+                    Node* node; // element under the cursor, nullptr before the first element
+
+                    friend class LinkedList;
+                    Cursor(LinkedList* list, Node* node) : list(list), node(node) {}
+
+                public:
+                    bool atStart() const; // True while the cursor is before the first element
+                    bool hasNext() const; // True if an element follows the cursor
+                    T& current() const; // The element under the cursor, modifiable in place
+                    T& peekNext() const; // The element after the cursor, modifiable in place
+                    void advance(); // Moves onto the next element
+                    void insertAfter(T value); // Inserts value right after the cursor, the cursor stays put
+                    T eraseAfter(); // Removes and returns the element right after the cursor
+            };
+
             // Constructor and destructor
             LinkedList(); // Constructor
+            explicit LinkedList(const Allocator& allocator); // Constructor allocating nodes from allocator
+            LinkedList(const LinkedList&) = delete;
+            LinkedList& operator=(const LinkedList&) = delete;
+            LinkedList(LinkedList&& other) noexcept; // Move constructor, takes over other's nodes and leaves it empty
+            LinkedList& operator=(LinkedList&& other); // Move assignment, relinks other's nodes if the allocators are equal
             ~LinkedList(); // Destructor
 
             // Core operations
@@ -24,7 +105,7 @@ namespace dsa {
             void insertAtEnd(T value); // Inserts element at the end of linked list
             void insertAt(int index, T value); // Inserts element at a specified index
             void set(int index, T value); // Modifies the element at the the specified index
-            T get(int index); // Returns the value at the specified index
+            T get(int index); // Returns the value at the specified index, O(1) amortized when called with increasing indices
 
             // Deletion
             T removeFirst(); // Returns the deleted value of the head or error for empty linked list
@@ -34,13 +115,46 @@ namespace dsa {
             // Searching
             int linearSearch(T value); // Returns the index of the found element or -1 if not found
 
+            // Splicing: nodes are relinked, never copied, when both lists use equal allocators
+            // (otherwise the elements are moved into new nodes one by one)
+            void splice(LinkedList&& other); // Appends all of other's elements in O(1) and leaves other empty
+            LinkedList splitAt(int index); // Cuts the list before index and returns the elements from index on, O(index)
+            void merge(LinkedList&& other); // Merges sorted other into this sorted list in O(n + m), stable, leaves other empty
+            template<typename Compare>
+            void merge(LinkedList&& other, Compare compare); // merge for lists sorted by compare(a, b) ("a before b")
+
             // Sorting
             void bubbleSort(); // Sorts the elements in ascending order
+            void mergeSort(); // Stable O(n log n) sort in ascending order, relinks nodes, O(1) extra space
+            template<typename Compare>
+            void mergeSort(Compare compare); // Stable O(n log n) sort ordered by compare(a, b) ("a before b")
+
+            // Iteration
+            iterator begin(); // Iterator to the first element
+            iterator end(); // Iterator past the last element
+            const_iterator begin() const; // Iterator to the first element
+            const_iterator end() const; // Iterator past the last element
+            Cursor cursor(); // Editing cursor before the first element
+            Cursor cursorAt(iterator position); // Editing cursor on the element at position
 
             // Utilities
             int getSize(); // Returns the total number of elements in linked list
             bool isEmpty(); // Checks whether linked list is empty
             void reverse(); // Reverses the linked list in place
             void print(); // Outputs all the elements in linked list
+            Allocator getAllocator() const; // Returns a copy of the allocator
     };
-}
\ No newline at end of file
+}
+
+#include "LinkedList.tpp"
+
+#ifdef DSA_EXPLICIT_INSTANTIATION
+#include <string>
+
+// Instantiated once in src/LinkedList.cpp instead of in every translation unit
+extern template class dsa::LinkedList<int>;
+extern template class dsa::LinkedList<double>;
+extern template class dsa::LinkedList<float>;
+extern template class dsa::LinkedList<char>;
+extern template class dsa::LinkedList<std::string>;
+#endif
\ No newline at end of file
@@ -0,0 +1,781 @@
+#pragma once
+// Template definitions for LinkedList.h (included at the end of LinkedList.h)
+#include "ChainMergeSort.h"
+#include <iostream>
+#include <algorithm> // For std::swap
+#include <stdexcept> // For std::out_of_range
+#include <type_traits>
+#include <utility>
+
+namespace dsa {
+    template<typename T, typename Allocator>
+    LinkedList<T, Allocator>::LinkedList() : LinkedList(Allocator()) {}
+
+    template<typename T, typename Allocator>
+    LinkedList<T, Allocator>::LinkedList(const Allocator& allocator) : allocator(allocator), finger(nullptr), fingerIndex(0) {
+        head = tail = nullptr;
+        count = 0;
+    }
+
+    template<typename T, typename Allocator>
+    typename LinkedList<T, Allocator>::Node* LinkedList<T, Allocator>::createNode(T value) {
+        /*
+        Algorithm to create a node:
+            -> Allocate storage for one node from the node allocator
+            -> Construct the node in place, releasing the storage if the constructor throws
+        */
+        Node* node = NodeAllocatorTraits::allocate(allocator, 1);
+        try {
+            NodeAllocatorTraits::construct(allocator, node, std::move(value));
+        } catch (...) {
+            NodeAllocatorTraits::deallocate(allocator, node, 1);
+            throw;
+        }
+        return node;
+    }
+
+    template<typename T, typename Allocator>
+    void LinkedList<T, Allocator>::destroyNode(Node* node) {
+        NodeAllocatorTraits::destroy(allocator, node);
+        NodeAllocatorTraits::deallocate(allocator, node, 1);
+    }
+
+    template<typename T, typename Allocator>
+    Allocator LinkedList<T, Allocator>::getAllocator() const {
+        return Allocator(allocator);
+    }
+
+    template<typename T, typename Allocator>
+    LinkedList<T, Allocator>::LinkedList(LinkedList&& other) noexcept
+        : head(other.head), tail(other.tail), count(other.count), allocator(other.allocator),
+          finger(other.finger), fingerIndex(other.fingerIndex) {
+        // the allocator is copied, not moved, so other can keep allocating from it
+        other.head = other.tail = nullptr;
+        other.count = 0;
+        other.invalidateFinger();
+    }
+
+    template<typename T, typename Allocator>
+    LinkedList<T, Allocator>& LinkedList<T, Allocator>::operator=(LinkedList&& other) {
+        /*
+        Algorithm for move assignment:
+            -> Destroy this list's nodes
+            -> splice other in: its nodes are relinked if the allocators are equal,
+               otherwise its elements are moved into nodes from this list's allocator
+        */
+        if (this == &other) {
+            return *this;
+        }
+        Node* current = head;
+        while (current != nullptr) {
+            Node* nextNode = current->next;
+            destroyNode(current);
+            current = nextNode;
+        }
+        head = tail = nullptr;
+        count = 0;
+        invalidateFinger();
+        splice(std::move(other));
+        return *this;
+    }
+
+    template<typename T, typename Allocator>
+    LinkedList<T, Allocator>::~LinkedList() {
+        /*
+        Algorithm to implement destructor:
+            -> Traverse through the linked list and delete each node to free memory
+            -> Set head and tail to nullptr after deletion
+            -> Set size to 0
+            -> Optionally, print a message indicating successful destruction
+            -> Handle edge case where linked list is already empty
+            -> Time Complexity: O(n), Space Complexity: O(1)
+
+            ** Monotonic allocators (ArenaAllocator): nodes are never freed one by one and
+               trivially destructible data needs no destructor, so the walk is skipped: O(1) **
+        */
+       if constexpr (std::is_trivially_destructible<T>::value && IsMonotonicAllocator<NodeAllocator>::value) {
+        head = tail = nullptr;
+        count = 0;
+        return;
+       }
+       Node* current = head;
+       Node* nextNode;
+       while (current != nullptr) {
+        nextNode = current->next;
+        destroyNode(current);
+        current = nextNode;
+       }
+       head = tail = nullptr;
+       count = 0;
+    }
+
+    template<typename T, typename Allocator>
+    void LinkedList<T, Allocator>::insertAtBeginning(T value) {
+        /*
+        Algorithm to implement insertAtBeginning:
+            -> Create a new node with the given value
+            -> If the linked list is empty, set head and tail to the new node
+            -> Otherwise, set the new node's next to the current head and update head to the new node
+            -> Increment the size of the linked list
+            -> Time Complexity: O(1), Space Complexity: O(1)
+        */
+        invalidateFinger();
+        Node* newNode = createNode(std::move(value));
+
+        if (isEmpty()) {
+            head = tail = newNode;
+        } else {
+            newNode->next = head;
+            head = newNode;
+        }
+        count++;
+    }
+
+    template<typename T, typename Allocator>
+    void LinkedList<T, Allocator>::insertAtEnd(T value) {
+        /*
+        Algorithm to insert at the end of the linked list:
+            -> Create a new node with the given value
+            -> If the linked list is empty, call insertAtBeginning
+            -> Otherwise, traverse to the last node and set its next to the new node
+            -> Update tail to the new node
+            -> Increment the size of the linked list
+            -> Time Complexity: O(n) in worst case, Space Complexity: O(1)
+
+            ** Inefficiency fix: use tail pointer to directly access the last node in O(1) time **
+                -> If the linked list is empty, call insertAtBeginning
+                -> Otherwise, set tail's next to the new node and update tail to the new node
+                -> Increment the size of the linked list
+                -> Time Complexity: O(1), Space Complexity: O(1)
+        */
+       if (isEmpty()) {
+        insertAtBeginning(std::move(value));
+        return;
+       } else {
+
+        // Node* current = head;
+        // while (current->next != nullptr) {
+        //     current = current->next;
+        // }
+        // current->next = newNode;
+        // tail = newNode;
+        // count++;
+
+        tail->next = createNode(std::move(value));
+        tail = tail->next;
+        count++;
+       }       
+    }
+
+    template<typename T, typename Allocator>
+    void LinkedList<T, Allocator>::insertAt(int index, T value) {
+        /*
+        Algorithm to implement insert at specified index:
+            -> Create a new node with the given value
+            -> If index is 0, call insertAtBeginning
+            -> Otherwise, traverse the linked list to find the node at (index - 1)
+            -> Set the new node's next to the current node's next and update current node's next to the new node
+            -> If the new node is inserted at the end, update tail to the new node
+            -> Increment the size of the linked list
+            -> Handle edge cases such as index out of bounds
+            -> Time Complexity: O(n) in worst case, Space Complexity: O(1)
+        */
+        invalidateFinger();
+        if (index == 0) {
+        insertAtBeginning(std::move(value));
+        return;
+        } else {
+        Node* newNode = createNode(std::move(value));
+        Node* current = head;
+        int i = 0;
+        while (i < (index - 1) && current != nullptr)
+        {
+            current = current->next;
+            i++;
+        }
+        if (current == nullptr)
+        {
+            destroyNode(newNode);
+            throw std::out_of_range("Index out of bounds");
+            return;
+        }
+        newNode->next = current->next;
+        current->next = newNode;
+        if (newNode->next == nullptr)
+        {
+            tail = newNode;
+        }
+        count++;
+       }
+    }
+
+    template<typename T, typename Allocator>
+    typename LinkedList<T, Allocator>::Node* LinkedList<T, Allocator>::nodeAt(int index) {
+        /*
+        Algorithm to find the node at index:
+            -> Return nullptr if index is out of bounds, and tail directly for the last index
+            -> Start from the finger (the node the previous get/set reached) if it is not past
+               index, otherwise from head, and walk forward to index
+            -> Remember the node reached as the new finger
+            -> Time Complexity: O(index - fingerIndex) after an earlier access at fingerIndex,
+               so get(0), get(1), ..., get(n - 1) is O(n) in total; O(index) otherwise
+        */
+       if (index < 0 || index >= count) {
+        return nullptr;
+       }
+       Node* current = head;
+       int i = 0;
+       if (index == count - 1) {
+        current = tail;
+        i = index;
+       } else if (finger != nullptr && fingerIndex <= index) {
+        current = finger;
+        i = fingerIndex;
+       }
+       while (i < index) {
+        current = current->next;
+        i++;
+       }
+       finger = current;
+       fingerIndex = index;
+       return current;
+    }
+
+    template<typename T, typename Allocator>
+    void LinkedList<T, Allocator>::invalidateFinger() {
+        finger = nullptr;
+        fingerIndex = 0;
+    }
+
+    template<typename T, typename Allocator>
+    void LinkedList<T, Allocator>::set(int index, T value) {
+        /*
+        Algorithm to implement set at specified index:
+            -> Traverse the linked list to find the node at the specified index
+            -> Update the node's data with the given value
+            -> Handle edge cases such as index out of bounds
+            -> Time Complexity: O(n) in worst case, Space Complexity: O(1)
+
+            ** Finger: nodeAt starts from the node the previous get/set reached when it is
+               not past index, so a loop over increasing indices costs O(1) amortized per call **
+        */
+       Node* current = nodeAt(index);
+       if (current == nullptr)
+       {
+        throw std::out_of_range("Index out of bounds");
+       }
+       current->data = value;
+    }
+
+    template<typename T, typename Allocator>
+    T LinkedList<T, Allocator>::get(int index) {
+        /*
+        Algorithm to implement get at specified index:
+            -> Traverse the linked list to find the node at the specified index
+            -> Return the node's data
+            -> Handle edge cases such as index out of bounds
+            -> Time Complexity: O(n) in worst case, Space Complexity: O(1)
+
+            ** Finger: as in set, sequential get(i) calls cost O(1) amortized each **
+        */
+       Node* current = nodeAt(index);
+       if (current == nullptr)
+       {
+        throw std::out_of_range("Index out of range");
+       }
+       return current->data;
+    }
+
+    template<typename T, typename Allocator>
+    T LinkedList<T, Allocator>::removeFirst() {
+        /*
+        Algorithm to implement removeFirst:
+            -> Check if the linked list is empty; if so, return an error or throw an exception
+            -> Store the data of the head node to return later
+            -> Update head to the next node
+            -> If head becomes nullptr, update tail to nullptr as well
+            -> Decrement the size of the linked list
+            -> Delete the old head node to free memory
+            -> Return the stored data
+            -> Time Complexity: O(1), Space Complexity: O(1)
+        */
+       invalidateFinger();
+       Node* temp = head;
+       if (isEmpty())
+       {
+        throw std::out_of_range("Cannot delete from empty linked list");
+       } else if (getSize() == 1) {
+        T data = temp->data;
+        head = tail = nullptr;
+        destroyNode(temp);
+        count--;
+
+        return data;
+       } else {
+       T data = temp->data;
+       head = head->next;
+       if (head == nullptr)
+       {
+        tail = nullptr;
+       }
+       destroyNode(temp);
+       count--;
+
+       return data;
+       }
+    }
+
+    template<typename T, typename Allocator>
+    T LinkedList<T, Allocator>::removeLast() {
+        /*
+        Algorithm to implement removeLast:
+            -> Check if the linked list is empty; if so, return an error or throw an exception
+            -> If there is only one node, store its data, set head and tail to nullptr, decrement size, delete the node, and return the data
+            -> Otherwise, traverse the linked list to find the second last node
+            -> Store the data of the tail node to return later
+            -> Update the second last node's next to nullptr and update tail to the second last node
+            -> Decrement the size of the linked list
+            -> Delete the old tail node to free memory
+            -> Return the stored data
+            -> Time Complexity: O(n) in worst case, Space Complexity: O(1)
+        */
+       invalidateFinger();
+       Node* temp = head;
+       if (isEmpty()) {
+        throw std::out_of_range("Cannot delete from empty linked list");
+       } else if (getSize() == 1) {
+        T data = temp->data;
+        head = tail = nullptr;
+        destroyNode(temp);
+        count--;
+
+        return data;
+       } else {
+        Node* prev = nullptr;
+        while (temp->next != nullptr)
+        {
+            prev = temp;
+            temp = temp->next;
+        }
+        T data = temp->data;
+        prev->next = nullptr;
+        tail = prev;
+        destroyNode(temp);
+        count--;
+
+        return data;
+       }
+    }
+
+    template<typename T, typename Allocator>
+    T LinkedList<T, Allocator>::removeAt(int index) {
+        /*
+        Algorithm to implement remove at specified index:
+            -> Check if the linked list is empty; if so, return an error or throw an exception
+            -> If index is 0, call removeFirst and return its result
+            -> Otherwise, traverse the linked list to find the node at (index - 1)
+            -> Store the data of the node to be deleted to return later
+            -> Update the (index - 1) node's next to skip the node to be deleted
+            -> If the deleted node is the tail, update tail to (index - 1) node
+            -> Decrement the size of the linked list
+            -> Delete the node to be removed to free memory
+            -> Return the stored data
+            -> Handle edge cases such as index out of bounds
+            -> Time Complexity: O(n) in worst case, Space Complexity: O(1)
+        */
+       invalidateFinger();
+       if (isEmpty()) {
+        throw std::out_of_range("Cannot delete from empty linked list");
+       }
+       if (index == 0) {
+        return removeFirst();
+       } else {
+        Node* current = head;
+        int i = 0;
+        while (i < (index - 1) && current != nullptr) {
+            current = current->next;
+            i++;
+        }
+        if (current == nullptr || current->next == nullptr) {
+            throw std::out_of_range("Index out of bounds");
+        }
+        Node* temp = current->next;
+        T data = temp->data;
+        current->next = temp->next;
+        destroyNode(temp);
+        if (current->next == nullptr) {
+            tail = current;
+        }
+        count--;
+
+        return data;
+       }
+    }
+
+    template<typename T, typename Allocator>
+    int LinkedList<T, Allocator>::linearSearch(T value) {
+        /*
+        Algorithm to implement linearSearch:
+            -> Initialize a current node pointer to head and an index counter to 0
+            -> Traverse the linked list:
+                -> If current node's data matches the value, return the current index
+                -> Move to the next node and increment the index counter
+            -> If the end of the list is reached without finding the value, return -1
+            -> Time Complexity: O(n), Space Complexity: O(1)
+        */
+       Node* current = head;
+        int index = 0;
+        while (current != nullptr) {
+            if (current->data == value) {
+                return index;
+            }
+            current = current->next;
+            index++;
+        }
+        return -1;
+    }
+
+    template<typename T, typename Allocator>
+    void LinkedList<T, Allocator>::bubbleSort() {
+        /* Algorithm to implement bubbleSort:
+            -> If the linked list is empty or has one element, return (already sorted)
+            -> Initialize a boolean flag to track if any swaps were made
+            -> Repeat until no swaps are made:
+                -> Set the flag to false
+                -> Traverse the linked list:
+                    -> Compare the current node's data with the next node's data
+                    -> If they are out of order, swap their data and set the flag to true
+            -> Time Complexity: O(n^2) in worst case, Space Complexity: O(1)
+        */
+       if (isEmpty() || getSize() == 1) {
+        return;
+       }
+       bool swapped;
+       do {
+        swapped = false;
+        Node* current = head;
+        while (current->next != nullptr) {
+            if (current->data > current->next->data) {
+                std::swap(current->data, current->next->data);
+                swapped = true;
+            }
+            current = current->next;
+        }
+       } while (swapped);
+    }
+
+    template<typename T, typename Allocator>
+    typename LinkedList<T, Allocator>::Node*& LinkedList<T, Allocator>::nextOf(Node* node) {
+        return node->next;
+    }
+
+    template<typename T, typename Allocator>
+    void LinkedList<T, Allocator>::mergeSort() {
+        mergeSort([](const T& a, const T& b) { return a < b; });
+    }
+
+    template<typename T, typename Allocator>
+    template<typename Compare>
+    void LinkedList<T, Allocator>::mergeSort(Compare compare) {
+        /* Algorithm to implement bottom-up merge sort:
+            -> If the linked list has fewer than two elements, return (already sorted)
+            -> For width = 1, 2, 4, ... while width < size:
+                -> Cut the list into consecutive runs of width nodes
+                -> Merge each pair of neighbouring runs by relinking next pointers and
+                   append the merged run to the new list
+            -> After the last pass, head and tail are the first and last merged nodes
+            -> No data is copied or swapped and no recursion or buffer is used
+            -> The passes are detail::mergeSortChain (ChainMergeSort.h), shared with
+               DoublyLinkedList and SkipList
+            -> Time Complexity: O(n log n), Space Complexity: O(1), stable
+        */
+       invalidateFinger();
+       if (count < 2) {
+        return;
+       }
+       head = detail::mergeSortChain(head, count, compare, tail, nextOf);
+    }
+
+    template<typename T, typename Allocator>
+    void LinkedList<T, Allocator>::splice(LinkedList&& other) {
+        /*
+        Algorithm to implement splice (append other):
+            -> Splicing a list into itself or splicing an empty list changes nothing
+            -> Equal allocators: this list can free other's nodes, so link other's head after
+               tail (or make it head if this list is empty), take over other's tail and count,
+               and reset other to empty. No node is allocated, copied or visited
+            -> Different allocators: move each element into a new node at the end of this
+               list, then destroy other's nodes
+            -> Time Complexity: O(1) (O(m) with different allocators), Space Complexity: O(1)
+        */
+        if (this == &other || other.head == nullptr) {
+            return;
+        }
+        if (allocator == other.allocator) {
+            if (tail == nullptr) {
+                head = other.head;
+            } else {
+                tail->next = other.head;
+            }
+            tail = other.tail;
+            count += other.count;
+            other.head = other.tail = nullptr;
+            other.count = 0;
+            other.invalidateFinger();
+            return;
+        }
+        Node* current = other.head;
+        while (current != nullptr) {
+            Node* nextNode = current->next;
+            insertAtEnd(std::move(current->data));
+            other.destroyNode(current);
+            current = nextNode;
+        }
+        other.head = other.tail = nullptr;
+        other.count = 0;
+        other.invalidateFinger();
+    }
+
+    template<typename T, typename Allocator>
+    LinkedList<T, Allocator> LinkedList<T, Allocator>::splitAt(int index) {
+        /*
+        Algorithm to implement splitAt:
+            -> Check the index is within [0, size]
+            -> Create the result list with a copy of this list's allocator, so either list can free the nodes
+            -> index 0: the result takes the whole chain; index size: the result stays empty
+            -> Otherwise walk to the node before index, hand the chain after it (with the old
+               tail and size - index elements) to the result and make that node the new tail
+            -> The finger stays valid unless it was on a node that moved to the result
+            -> Time Complexity: O(index), Space Complexity: O(1)
+        */
+        if (index < 0 || index > count) {
+            throw std::out_of_range("Index out of bounds");
+        }
+        LinkedList rest(getAllocator());
+        if (index == count) {
+            return rest;
+        }
+        if (fingerIndex >= index) {
+            invalidateFinger();
+        }
+        Node* last = nullptr;
+        Node* first = head;
+        for (int i = 0; i < index; i++) {
+            last = first;
+            first = first->next;
+        }
+        rest.head = first;
+        rest.tail = tail;
+        rest.count = count - index;
+        if (last == nullptr) {
+            head = nullptr;
+        } else {
+            last->next = nullptr;
+        }
+        tail = last;
+        count = index;
+        return rest;
+    }
+
+    template<typename T, typename Allocator>
+    void LinkedList<T, Allocator>::merge(LinkedList&& other) {
+        merge(std::move(other), [](const T& a, const T& b) { return a < b; });
+    }
+
+    template<typename T, typename Allocator>
+    template<typename Compare>
+    void LinkedList<T, Allocator>::merge(LinkedList&& other, Compare compare) {
+        /*
+        Algorithm to implement merge (both lists sorted by compare):
+            -> Merging a list into itself or merging an empty list changes nothing
+            -> Different allocators: first move other's elements into a list that uses this
+               list's allocator (splice does that) and merge that one instead
+            -> Otherwise relink both chains with detail::mergeChains, the same stable merge mergeSort uses
+               (on ties this list's elements come first), and take over other's count
+            -> Time Complexity: O(n + m), Space Complexity: O(1), no node is allocated or copied
+        */
+        if (this == &other || other.head == nullptr) {
+            return;
+        }
+        if (!(allocator == other.allocator)) {
+            LinkedList moved(getAllocator());
+            moved.splice(std::move(other));
+            merge(std::move(moved), compare);
+            return;
+        }
+        invalidateFinger();
+        other.invalidateFinger();
+        Node* last = nullptr;
+        head = detail::mergeChains(head, other.head, compare, last, nextOf);
+        tail = last;
+        count += other.count;
+        other.head = other.tail = nullptr;
+        other.count = 0;
+    }
+
+    template<typename T, typename Allocator>
+    typename LinkedList<T, Allocator>::iterator LinkedList<T, Allocator>::begin() {
+        return iterator(head);
+    }
+
+    template<typename T, typename Allocator>
+    typename LinkedList<T, Allocator>::iterator LinkedList<T, Allocator>::end() {
+        return iterator(nullptr);
+    }
+
+    template<typename T, typename Allocator>
+    typename LinkedList<T, Allocator>::const_iterator LinkedList<T, Allocator>::begin() const {
+        return const_iterator(head);
+    }
+
+    template<typename T, typename Allocator>
+    typename LinkedList<T, Allocator>::const_iterator LinkedList<T, Allocator>::end() const {
+        return const_iterator(nullptr);
+    }
+
+    template<typename T, typename Allocator>
+    typename LinkedList<T, Allocator>::Cursor LinkedList<T, Allocator>::cursor() {
+        return Cursor(this, nullptr);
+    }
+
+    template<typename T, typename Allocator>
+    typename LinkedList<T, Allocator>::Cursor LinkedList<T, Allocator>::cursorAt(iterator position) {
+        if (position.node == nullptr) {
+            throw std::out_of_range("Cursor cannot be placed at end()");
+        }
+        return Cursor(this, position.node);
+    }
+
+    template<typename T, typename Allocator>
+    bool LinkedList<T, Allocator>::Cursor::atStart() const { return node == nullptr; }
+
+    template<typename T, typename Allocator>
+    bool LinkedList<T, Allocator>::Cursor::hasNext() const {
+        return (node == nullptr) ? list->head != nullptr : node->next != nullptr;
+    }
+
+    template<typename T, typename Allocator>
+    T& LinkedList<T, Allocator>::Cursor::current() const {
+        if (node == nullptr) {
+            throw std::out_of_range("Cursor is before the first element");
+        }
+        return node->data;
+    }
+
+    template<typename T, typename Allocator>
+    T& LinkedList<T, Allocator>::Cursor::peekNext() const {
+        if (!hasNext()) {
+            throw std::out_of_range("No element after the cursor");
+        }
+        return (node == nullptr) ? list->head->data : node->next->data;
+    }
+
+    template<typename T, typename Allocator>
+    void LinkedList<T, Allocator>::Cursor::advance() {
+        if (!hasNext()) {
+            throw std::out_of_range("No element after the cursor");
+        }
+        node = (node == nullptr) ? list->head : node->next;
+    }
+
+    template<typename T, typename Allocator>
+    void LinkedList<T, Allocator>::Cursor::insertAfter(T value) {
+        /*
+        Algorithm to insert after the cursor:
+            -> Before the first element this is insertAtBeginning
+            -> Otherwise link a new node between the cursor's node and its successor,
+               and make it the tail if the cursor was on the tail
+            -> Time Complexity: O(1), Space Complexity: O(1)
+        */
+        list->invalidateFinger();
+        if (node == nullptr) {
+            list->insertAtBeginning(std::move(value));
+            return;
+        }
+        Node* newNode = list->createNode(std::move(value));
+        newNode->next = node->next;
+        node->next = newNode;
+        if (list->tail == node) {
+            list->tail = newNode;
+        }
+        list->count++;
+    }
+
+    template<typename T, typename Allocator>
+    T LinkedList<T, Allocator>::Cursor::eraseAfter() {
+        /*
+        Algorithm to erase after the cursor:
+            -> Check an element follows the cursor; if not, throw an exception
+            -> Before the first element this is removeFirst
+            -> Otherwise unlink the successor, moving tail back to the cursor's node if the
+               successor was the tail, and destroy it after moving its value out
+            -> Time Complexity: O(1), Space Complexity: O(1)
+        */
+        list->invalidateFinger();
+        if (!hasNext()) {
+            throw std::out_of_range("No element after the cursor");
+        }
+        if (node == nullptr) {
+            return list->removeFirst();
+        }
+        Node* removed = node->next;
+        node->next = removed->next;
+        if (list->tail == removed) {
+            list->tail = node;
+        }
+        list->count--;
+        T value = std::move(removed->data);
+        list->destroyNode(removed);
+        return value;
+    }
+
+    template<typename T, typename Allocator>
+    int LinkedList<T, Allocator>::getSize() { return count; }
+
+    template<typename T, typename Allocator>
+    bool LinkedList<T, Allocator>::isEmpty() { return count == 0; }
+
+    template<typename T, typename Allocator>
+    void LinkedList<T, Allocator>::reverse() {
+        /* Algorithm to implement reverse:
+            -> Initialize three pointers: prev as nullptr, current as head, and next as nullptr
+            -> Traverse the linked list:
+                -> Store the next node (current->next) in next
+                -> Reverse the current node's pointer (current->next = prev)
+                -> Move prev and current one step forward (prev = current, current = next)
+            -> After the loop, set head to prev (new head of the reversed list)
+            -> The old head is the new tail, so update tail as well
+            -> Time Complexity: O(n), Space Complexity: O(1)
+        */
+         invalidateFinger();
+         tail = head;
+         Node* prev = nullptr;
+         Node* current = head;
+         Node* next = nullptr;
+
+         while (current != nullptr) {
+            next = current->next;
+            current->next = prev;
+            prev = current;
+            current = next;
+         }
+         head = prev;
+    }
+
+    template<typename T, typename Allocator>
+    void LinkedList<T, Allocator>::print() {
+        /*
+        Algorithm to implement print:
+            -> Initialize a current node pointer to head
+            -> Traverse the linked list:
+                -> Print the current node's data
+                -> Move to the next node
+            -> Time Complexity: O(n), Space Complexity: O(1)
+        */
+       Node* current = head;
+       while (current != nullptr) {
+        std::cout << current->data << " ";
+        current = current->next;
+       }
+    }
+}
\ No newline at end of file
@@ -0,0 +1,109 @@
+#pragma once
+#include "../../Memory/include/MonotonicArena.h"
+#include "../../Memory/include/SlabPool.h"
+#include <memory>
+#include <random>
+
+namespace dsa {
+    // Indexable skip list with the LinkedList interface. Above the ordinary chain of
+    // nodes (level 0) every node has a random number of express links (each level up is
+    // kept with probability 1/4), and every link records its width: how many positions
+    // it skips. Walking down from the top level and adding up widths reaches any index
+    // in expected O(log n), so get/set/insertAt/removeAt no longer walk from the head.
+    // When the elements are kept sorted, insertSorted and binarySearch place and find
+    // values in expected O(log n) as well. Allocator works as in LinkedList.
+    template<typename T, typename Allocator = PoolAllocator<T>>
+    class SkipList {
+        private:
+            struct Node;
+
+            struct Link {
+                Node* next; // next node on this level, nullptr past the last one
+                int width; // positions from this node to next (to one past the end if next is nullptr)
+            };
+
+            struct Node {
+                T data;
+                int height; // number of levels this node is linked into
+                Link* links; // links[0 .. height), links[0] is the plain next pointer
+                Node(T value, int height, Link* links) : data(std::move(value)), height(height), links(links) {}
+            };
+
+            using NodeAllocator = typename std::allocator_traits<Allocator>::template rebind_alloc<Node>;
+            using NodeAllocatorTraits = std::allocator_traits<NodeAllocator>;
+            using LinkAllocator = typename std::allocator_traits<Allocator>::template rebind_alloc<Link>;
+            using LinkAllocatorTraits = std::allocator_traits<LinkAllocator>;
+
+            static constexpr int MAX_LEVEL = 16; // 4^15 expected elements per top-level link, enough for int sizes
+
+            Link heads[MAX_LEVEL]; // Links out of the (virtual) head at position 0; only [0, levels) are valid
+            int levels; // Number of levels in use, at least 1
+            int count; // Number of elements in the list
+            NodeAllocator allocator; // Allocates the nodes
+            LinkAllocator linkAllocator; // Allocates the link towers
+            std::minstd_rand generator; // Draws node heights
+
+            Node* createNode(T value, int height); // Allocates a node and its tower of height links
+            void destroyNode(Node* node); // Destroys and deallocates a node and its tower
+            int randomHeight(); // Returns 1 + the number of 1/4-probability coin flips in a row, at most MAX_LEVEL
+            Node* nodeAt(int index) const; // Returns the node at index
+            template<typename Before>
+            void findPredecessors(Before before, Link** update, int* rank); // Last tower per level for which before(next, position) holds
+            void linkNode(Node* node, Link** update, int* rank); // Links node right after the predecessors found, adding levels if node is taller
+            Node* unlinkNext(Link** update); // Unlinks the node right after the predecessors found
+            T removeNext(Link** update); // Unlinks, destroys and returns the value after the predecessors found
+            void rebuildLinks(); // Recomputes every express link and width from the level 0 order
+
+        public:
+            // Constructor and destructor
+            SkipList(); // Constructor
+            explicit SkipList(const Allocator& allocator); // Constructor allocating nodes from allocator
+            SkipList(const SkipList&) = delete;
+            SkipList& operator=(const SkipList&) = delete;
+            ~SkipList(); // Destructor
+
+            // Core operations
+            void insertAtBeginning(T value); // Inserts element at the beginning of the list
+            void insertAtEnd(T value); // Inserts element at the end of the list
+            void insertAt(int index, T value); // Inserts element at a specified index
+            void set(int index, T value); // Modifies the element at the specified index
+            T get(int index) const; // Returns the value at the specified index
+
+            // Deletion
+            T removeFirst(); // Returns the deleted first value or error for empty list
+            T removeLast(); // Returns the deleted last value or error for empty list
+            T removeAt(int index); // Returns the deleted value at the specified index or error for empty list
+
+            // Searching
+            int linearSearch(T value) const; // Returns the index of the found element or -1 if not found
+
+            // Ordered operations, valid while the list is sorted in ascending order
+            int insertSorted(T value); // Inserts value after every element not greater than it, returns its index
+            int binarySearch(T value) const; // Returns the index of the first element equal to value or -1 if not found
+
+            // Sorting
+            void mergeSort(); // Stable O(n log n) sort in ascending order, relinks nodes, O(1) extra space
+            template<typename Compare>
+            void mergeSort(Compare compare); // Stable O(n log n) sort ordered by compare(a, b) ("a before b")
+
+            // Utilities
+            int getSize() const; // Returns the total number of elements in the list
+            bool isEmpty() const; // Checks whether the list is empty
+            void reverse(); // Reverses the list in place
+            void print() const; // Outputs all the elements in the list
+            Allocator getAllocator() const; // Returns a copy of the allocator
+    };
+}
+
+#include "SkipList.tpp"
+
+#ifdef DSA_EXPLICIT_INSTANTIATION
+#include <string>
+
+// Instantiated once in src/SkipList.cpp instead of in every translation unit
+extern template class dsa::SkipList<int>;
+extern template class dsa::SkipList<double>;
+extern template class dsa::SkipList<float>;
+extern template class dsa::SkipList<char>;
+extern template class dsa::SkipList<std::string>;
+#endif
\ No newline at end of file
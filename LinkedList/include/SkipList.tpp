@@ -0,0 +1,421 @@
+#pragma once
+// Template definitions for SkipList.h (included at the end of SkipList.h)
+#include "ChainMergeSort.h"
+#include <iostream>
+#include <stdexcept> // For std::out_of_range
+#include <type_traits>
+#include <utility>
+
+namespace dsa {
+    template<typename T, typename Allocator>
+    SkipList<T, Allocator>::SkipList() : SkipList(Allocator()) {}
+
+    template<typename T, typename Allocator>
+    SkipList<T, Allocator>::SkipList(const Allocator& allocator)
+        : heads(), levels(1), count(0), allocator(allocator), linkAllocator(allocator), generator() {
+        heads[0] = Link{nullptr, 1};
+    }
+
+    template<typename T, typename Allocator>
+    SkipList<T, Allocator>::~SkipList() {
+        // skipped entirely for arena-backed trivially destructible data
+        if constexpr (!(std::is_trivially_destructible<T>::value && IsMonotonicAllocator<NodeAllocator>::value)) {
+            Node* current = heads[0].next;
+            while (current != nullptr) {
+                Node* nextNode = current->links[0].next;
+                destroyNode(current);
+                current = nextNode;
+            }
+        }
+        heads[0] = Link{nullptr, 1};
+        levels = 1;
+        count = 0;
+    }
+
+    template<typename T, typename Allocator>
+    typename SkipList<T, Allocator>::Node* SkipList<T, Allocator>::createNode(T value, int height) {
+        /*
+        Algorithm to create a node:
+            -> Allocate storage for the node, then its tower of height links (in this order, so a
+               shared pool is sized for nodes; height 1 towers come from the same slots)
+            -> Construct the node in place, releasing both if anything throws
+        */
+        Node* node = NodeAllocatorTraits::allocate(allocator, 1);
+        Link* links;
+        try {
+            links = LinkAllocatorTraits::allocate(linkAllocator, height);
+        } catch (...) {
+            NodeAllocatorTraits::deallocate(allocator, node, 1);
+            throw;
+        }
+        try {
+            NodeAllocatorTraits::construct(allocator, node, std::move(value), height, links);
+        } catch (...) {
+            LinkAllocatorTraits::deallocate(linkAllocator, links, height);
+            NodeAllocatorTraits::deallocate(allocator, node, 1);
+            throw;
+        }
+        return node;
+    }
+
+    template<typename T, typename Allocator>
+    void SkipList<T, Allocator>::destroyNode(Node* node) {
+        Link* links = node->links;
+        int height = node->height;
+        NodeAllocatorTraits::destroy(allocator, node);
+        NodeAllocatorTraits::deallocate(allocator, node, 1);
+        LinkAllocatorTraits::deallocate(linkAllocator, links, height);
+    }
+
+    template<typename T, typename Allocator>
+    int SkipList<T, Allocator>::randomHeight() {
+        // each pair of random bits is one coin flip that comes up "go higher" with probability 1/4;
+        // minstd_rand yields 31 bits, enough for the MAX_LEVEL - 1 = 15 flips
+        unsigned int bits = static_cast<unsigned int>(generator());
+        int height = 1;
+        while (height < MAX_LEVEL && (bits & 3u) == 0) {
+            height++;
+            bits >>= 2;
+        }
+        return height;
+    }
+
+    template<typename T, typename Allocator>
+    typename SkipList<T, Allocator>::Node* SkipList<T, Allocator>::nodeAt(int index) const {
+        /*
+        Algorithm to find the node at index (0 <= index < size, the node at index is at position index + 1):
+            -> Start at the head (position 0) on the top level
+            -> On each level, follow links while the position they lead to is not past index + 1,
+               adding their widths to the position, then drop one level
+            -> After level 0 the position is index + 1
+            -> Time Complexity: expected O(log n), Space Complexity: O(1)
+        */
+        const Link* tower = heads;
+        Node* current = nullptr;
+        int position = 0;
+        for (int level = levels - 1; level >= 0; level--) {
+            while (tower[level].next != nullptr && position + tower[level].width <= index + 1) {
+                position += tower[level].width;
+                current = tower[level].next;
+                tower = current->links;
+            }
+        }
+        return current;
+    }
+
+    template<typename T, typename Allocator>
+    template<typename Before>
+    void SkipList<T, Allocator>::findPredecessors(Before before, Link** update, int* rank) {
+        /*
+        Algorithm to find the predecessors of an insertion or removal point:
+            -> Walk down from the top level like nodeAt, following a link while before(next node,
+               position of next node) holds
+            -> Before dropping from a level, record the tower where the walk stopped (update) and its
+               position (rank); these are the links that have to change
+            -> Time Complexity: expected O(log n), Space Complexity: O(1)
+        */
+        Link* tower = heads;
+        int position = 0;
+        for (int level = levels - 1; level >= 0; level--) {
+            while (tower[level].next != nullptr && before(tower[level].next, position + tower[level].width)) {
+                position += tower[level].width;
+                tower = tower[level].next->links;
+            }
+            update[level] = tower;
+            rank[level] = position;
+        }
+    }
+
+    template<typename T, typename Allocator>
+    void SkipList<T, Allocator>::linkNode(Node* node, Link** update, int* rank) {
+        /*
+        Algorithm to link a node after the predecessors:
+            -> The node takes position rank[0] + 1
+            -> If the node is taller than the list, start the new levels at the head with a link
+               to the end (width = size + 1)
+            -> On the node's levels, split the predecessor's link: the predecessor now points to the
+               node and the node takes over the rest of the old link, one position longer
+            -> On the levels above the node, the predecessor's link skips one more position
+            -> Time Complexity: O(height), Space Complexity: O(1)
+        */
+        int position = rank[0] + 1;
+        while (levels < node->height) {
+            heads[levels] = Link{nullptr, count + 1};
+            update[levels] = heads;
+            rank[levels] = 0;
+            levels++;
+        }
+        for (int level = 0; level < node->height; level++) {
+            Link& previous = update[level][level];
+            node->links[level] = Link{previous.next, rank[level] + previous.width + 1 - position};
+            previous.next = node;
+            previous.width = position - rank[level];
+        }
+        for (int level = node->height; level < levels; level++) {
+            update[level][level].width++;
+        }
+        count++;
+    }
+
+    template<typename T, typename Allocator>
+    typename SkipList<T, Allocator>::Node* SkipList<T, Allocator>::unlinkNext(Link** update) {
+        /*
+        Algorithm to unlink the node after the predecessors:
+            -> On the node's levels, the predecessor's link takes over the node's link
+               (widths add up, minus the removed position)
+            -> On the levels above the node, the predecessor's link skips one position less
+            -> Drop top levels the head no longer links anywhere
+            -> Time Complexity: O(levels), Space Complexity: O(1)
+        */
+        Node* node = update[0][0].next;
+        for (int level = 0; level < levels; level++) {
+            Link& previous = update[level][level];
+            if (level < node->height) {
+                previous.width += node->links[level].width - 1;
+                previous.next = node->links[level].next;
+            } else {
+                previous.width--;
+            }
+        }
+        while (levels > 1 && heads[levels - 1].next == nullptr) {
+            levels--;
+        }
+        count--;
+        return node;
+    }
+
+    template<typename T, typename Allocator>
+    T SkipList<T, Allocator>::removeNext(Link** update) {
+        Node* node = unlinkNext(update);
+        T value = std::move(node->data);
+        destroyNode(node);
+        return value;
+    }
+
+    template<typename T, typename Allocator>
+    void SkipList<T, Allocator>::rebuildLinks() {
+        /*
+        Algorithm to rebuild the express links after the level 0 order changed:
+            -> Keep every node's height; walk level 0 counting positions
+            -> On each of a node's levels, link the last tower seen on that level to the node
+               with width = position difference, and make the node the last tower on that level
+            -> Finally link the last tower on every level to the end (width to size + 1)
+            -> Time Complexity: O(n), Space Complexity: O(1)
+        */
+        Link* last[MAX_LEVEL] = {};
+        int lastPosition[MAX_LEVEL] = {};
+        for (int level = 0; level < levels; level++) {
+            last[level] = heads;
+            lastPosition[level] = 0;
+        }
+        int position = 0;
+        Node* current = heads[0].next;
+        while (current != nullptr) {
+            Node* nextNode = current->links[0].next;
+            position++;
+            for (int level = 0; level < current->height; level++) {
+                last[level][level] = Link{current, position - lastPosition[level]};
+                last[level] = current->links;
+                lastPosition[level] = position;
+            }
+            current = nextNode;
+        }
+        for (int level = 0; level < levels; level++) {
+            last[level][level] = Link{nullptr, count + 1 - lastPosition[level]};
+        }
+    }
+
+    template<typename T, typename Allocator>
+    void SkipList<T, Allocator>::insertAtBeginning(T value) {
+        insertAt(0, std::move(value));
+    }
+
+    template<typename T, typename Allocator>
+    void SkipList<T, Allocator>::insertAtEnd(T value) {
+        insertAt(count, std::move(value));
+    }
+
+    template<typename T, typename Allocator>
+    void SkipList<T, Allocator>::insertAt(int index, T value) {
+        /*
+        Algorithm to implement insert at specified index:
+            -> Check the index is within [0, size]
+            -> Find the predecessors of position index + 1 (everything at a position <= index)
+            -> Create a node of random height and link it after them
+            -> Time Complexity: expected O(log n), Space Complexity: O(1) expected extra links per node
+        */
+        if (index < 0 || index > count) {
+            throw std::out_of_range("Index out of bounds");
+        }
+        Link* update[MAX_LEVEL] = {};
+        int rank[MAX_LEVEL] = {};
+        findPredecessors([index](Node*, int position) { return position <= index; }, update, rank);
+        linkNode(createNode(std::move(value), randomHeight()), update, rank);
+    }
+
+    template<typename T, typename Allocator>
+    void SkipList<T, Allocator>::set(int index, T value) {
+        if (index < 0 || index >= count) {
+            throw std::out_of_range("Index out of bounds");
+        }
+        nodeAt(index)->data = std::move(value);
+    }
+
+    template<typename T, typename Allocator>
+    T SkipList<T, Allocator>::get(int index) const {
+        // follows express links, Time Complexity: expected O(log n)
+        if (index < 0 || index >= count) {
+            throw std::out_of_range("Index out of range");
+        }
+        return nodeAt(index)->data;
+    }
+
+    template<typename T, typename Allocator>
+    T SkipList<T, Allocator>::removeFirst() {
+        if (count == 0) {
+            throw std::out_of_range("Cannot delete from empty linked list");
+        }
+        return removeAt(0);
+    }
+
+    template<typename T, typename Allocator>
+    T SkipList<T, Allocator>::removeLast() {
+        if (count == 0) {
+            throw std::out_of_range("Cannot delete from empty linked list");
+        }
+        return removeAt(count - 1);
+    }
+
+    template<typename T, typename Allocator>
+    T SkipList<T, Allocator>::removeAt(int index) {
+        /*
+        Algorithm to implement remove at specified index:
+            -> Check the list is not empty and the index is within [0, size)
+            -> Find the predecessors of position index + 1, unlink the node after them and return its value
+            -> Time Complexity: expected O(log n), Space Complexity: O(1)
+        */
+        if (count == 0) {
+            throw std::out_of_range("Cannot delete from empty linked list");
+        }
+        if (index < 0 || index >= count) {
+            throw std::out_of_range("Index out of bounds");
+        }
+        Link* update[MAX_LEVEL] = {};
+        int rank[MAX_LEVEL] = {};
+        findPredecessors([index](Node*, int position) { return position <= index; }, update, rank);
+        return removeNext(update);
+    }
+
+    template<typename T, typename Allocator>
+    int SkipList<T, Allocator>::linearSearch(T value) const {
+        int index = 0;
+        for (Node* current = heads[0].next; current != nullptr; current = current->links[0].next) {
+            if (current->data == value) {
+                return index;
+            }
+            index++;
+        }
+        return -1;
+    }
+
+    template<typename T, typename Allocator>
+    int SkipList<T, Allocator>::insertSorted(T value) {
+        /*
+        Algorithm to implement insertSorted (list sorted in ascending order):
+            -> Find the predecessors by value: follow a link while the node it leads to is not
+               greater than value, so value goes after equal elements (insertion order is kept)
+            -> Link a node of random height after them; its index is the predecessor's position
+            -> Time Complexity: expected O(log n), Space Complexity: O(1) expected extra links per node
+        */
+        Link* update[MAX_LEVEL] = {};
+        int rank[MAX_LEVEL] = {};
+        findPredecessors([&value](Node* next, int) { return !(value < next->data); }, update, rank);
+        linkNode(createNode(std::move(value), randomHeight()), update, rank);
+        return rank[0];
+    }
+
+    template<typename T, typename Allocator>
+    int SkipList<T, Allocator>::binarySearch(T value) const {
+        /*
+        Algorithm to implement binarySearch (list sorted in ascending order):
+            -> Walk down from the top level following links while the node they lead to is less
+               than value, adding up widths
+            -> The node after the stopping point is the first one not less than value; it is a
+               match if value is not less than it either, at index = position of the stopping point
+            -> Time Complexity: expected O(log n), Space Complexity: O(1)
+        */
+        const Link* tower = heads;
+        int position = 0;
+        for (int level = levels - 1; level >= 0; level--) {
+            while (tower[level].next != nullptr && tower[level].next->data < value) {
+                position += tower[level].width;
+                tower = tower[level].next->links;
+            }
+        }
+        Node* candidate = tower[0].next;
+        if (candidate != nullptr && !(value < candidate->data)) {
+            return position;
+        }
+        return -1;
+    }
+
+    template<typename T, typename Allocator>
+    void SkipList<T, Allocator>::mergeSort() {
+        mergeSort([](const T& a, const T& b) { return a < b; });
+    }
+
+    template<typename T, typename Allocator>
+    template<typename Compare>
+    void SkipList<T, Allocator>::mergeSort(Compare compare) {
+        /* Algorithm to implement bottom-up merge sort:
+            -> Sort along the level 0 links with detail::mergeSortChain, the stable bottom-up
+               merge sort LinkedList::mergeSort uses (nodes are relinked, never copied)
+            -> The merges ignore the express links, so rebuild them in one final pass
+            -> Time Complexity: O(n log n), Space Complexity: O(1), stable
+        */
+        if (count < 2) {
+            return;
+        }
+        Node* last = nullptr;
+        heads[0].next = detail::mergeSortChain(heads[0].next, count, compare, last,
+                                               [](Node* node) -> Node*& { return node->links[0].next; });
+        rebuildLinks();
+    }
+
+    template<typename T, typename Allocator>
+    int SkipList<T, Allocator>::getSize() const { return count; }
+
+    template<typename T, typename Allocator>
+    bool SkipList<T, Allocator>::isEmpty() const { return count == 0; }
+
+    template<typename T, typename Allocator>
+    void SkipList<T, Allocator>::reverse() {
+        /* Algorithm to implement reverse:
+            -> Reverse the level 0 chain like LinkedList::reverse
+            -> Rebuild the express links for the new order (node heights are kept)
+            -> Time Complexity: O(n), Space Complexity: O(1)
+        */
+        Node* prev = nullptr;
+        Node* current = heads[0].next;
+        while (current != nullptr) {
+            Node* next = current->links[0].next;
+            current->links[0].next = prev;
+            prev = current;
+            current = next;
+        }
+        heads[0].next = prev;
+        rebuildLinks();
+    }
+
+    template<typename T, typename Allocator>
+    void SkipList<T, Allocator>::print() const {
+        for (Node* current = heads[0].next; current != nullptr; current = current->links[0].next) {
+            std::cout << current->data << " ";
+        }
+    }
+
+    template<typename T, typename Allocator>
+    Allocator SkipList<T, Allocator>::getAllocator() const {
+        return Allocator(allocator);
+    }
+}
\ No newline at end of file
@@ -0,0 +1,88 @@
+#pragma once
+#include "../../Memory/include/MonotonicArena.h"
+#include "../../Memory/include/SlabPool.h"
+#include <memory>
+
+namespace dsa {
+    // Unrolled linked list: every node holds up to K elements in a small inline array,
+    // so a scan touches one node header per K elements and walks contiguous memory in
+    // between. Nodes are split when an insertion overfills them and merged with (or
+    // refilled from) their successor when a removal leaves them less than half full.
+    template<typename T, int K = 16, typename Allocator = PoolAllocator<T>>
+    class UnrolledLinkedList {
+        static_assert(K >= 2, "UnrolledLinkedList needs at least two elements per node");
+
+        private:
+            struct Node {
+                Node* next; // next node
+                int count; // number of live elements in storage
+                alignas(T) unsigned char storage[K * sizeof(T)]; // uninitialized slots, [0, count) are live
+
+                Node() : next(nullptr), count(0) {}
+                T* elements() { return reinterpret_cast<T*>(storage); }
+            };
+
+            using NodeAllocator = typename std::allocator_traits<Allocator>::template rebind_alloc<Node>;
+            using NodeAllocatorTraits = std::allocator_traits<NodeAllocator>;
+
+            static constexpr int MIN_FILL = K / 2; // every node other than the last is kept at least this full
+
+            Node* head; // The first node
+            Node* tail; // The last node
+            int count; // Number of elements in the list
+            int nodeCount; // Number of nodes in the list
+            NodeAllocator allocator; // Allocates the nodes
+
+            Node* createNode(); // Allocates an empty node
+            void destroyNode(Node* node); // Destroys the node's elements and deallocates it
+            Node* findNode(int& index, Node*& previous) const; // Returns the node holding index, index becomes the offset inside it
+            Node* splitNode(Node* node); // Moves the upper half of a full node into a new successor node
+            void insertInto(Node* node, int offset, T value); // Inserts value at offset inside node, splitting it if full
+            T removeFrom(Node* node, Node* previous, int offset); // Removes the element at offset and rebalances node
+            void rebalance(Node* node, Node* previous); // Merges or refills an underfull node, unlinks an empty one
+
+        public:
+            // Constructor and destructor
+            UnrolledLinkedList(); // Constructor
+            explicit UnrolledLinkedList(const Allocator& allocator); // Constructor allocating nodes from allocator
+            UnrolledLinkedList(const UnrolledLinkedList&) = delete;
+            UnrolledLinkedList& operator=(const UnrolledLinkedList&) = delete;
+            ~UnrolledLinkedList(); // Destructor
+
+            // Core operations
+            void insertAtBeginning(T value); // Inserts element at the beginning of the list
+            void insertAtEnd(T value); // Inserts element at the end of the list
+            void insertAt(int index, T value); // Inserts element at a specified index
+            void set(int index, T value); // Modifies the element at the specified index
+            T get(int index) const; // Returns the value at the specified index
+
+            // Deletion
+            T removeFirst(); // Returns the deleted first value or error for empty list
+            T removeLast(); // Returns the deleted last value or error for empty list
+            T removeAt(int index); // Returns the deleted value at the specified index or error for empty list
+
+            // Searching
+            int linearSearch(T value) const; // Returns the index of the found element or -1 if not found
+
+            // Utilities
+            int getSize() const; // Returns the total number of elements in the list
+            int getNodeCount() const; // Returns the number of nodes in the list
+            bool isEmpty() const; // Checks whether the list is empty
+            void reverse(); // Reverses the list in place
+            void print() const; // Outputs all the elements in the list
+            Allocator getAllocator() const; // Returns a copy of the allocator
+    };
+}
+
+#include "UnrolledLinkedList.tpp"
+
+#ifdef DSA_EXPLICIT_INSTANTIATION
+#include <string>
+
+// Instantiated once in src/UnrolledLinkedList.cpp instead of in every translation unit
+extern template class dsa::UnrolledLinkedList<int>;
+extern template class dsa::UnrolledLinkedList<double>;
+extern template class dsa::UnrolledLinkedList<float>;
+extern template class dsa::UnrolledLinkedList<char>;
+extern template class dsa::UnrolledLinkedList<std::string>;
+#endif
\ No newline at end of file
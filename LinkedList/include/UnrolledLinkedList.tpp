@@ -0,0 +1,406 @@
+#pragma once
+// Template definitions for UnrolledLinkedList.h (included at the end of UnrolledLinkedList.h)
+#include <algorithm> // For std::reverse
+#include <iostream>
+#include <new>
+#include <stdexcept> // For std::out_of_range
+#include <type_traits>
+#include <utility>
+
+namespace dsa {
+    template<typename T, int K, typename Allocator>
+    UnrolledLinkedList<T, K, Allocator>::UnrolledLinkedList() : UnrolledLinkedList(Allocator()) {}
+
+    template<typename T, int K, typename Allocator>
+    UnrolledLinkedList<T, K, Allocator>::UnrolledLinkedList(const Allocator& allocator)
+        : head(nullptr), tail(nullptr), count(0), nodeCount(0), allocator(allocator) {}
+
+    template<typename T, int K, typename Allocator>
+    UnrolledLinkedList<T, K, Allocator>::~UnrolledLinkedList() {
+        // one destroyNode per K elements; skipped entirely for arena-backed trivially destructible data
+        if constexpr (!(std::is_trivially_destructible<T>::value && IsMonotonicAllocator<NodeAllocator>::value)) {
+            Node* current = head;
+            while (current != nullptr) {
+                Node* nextNode = current->next;
+                destroyNode(current);
+                current = nextNode;
+            }
+        }
+        head = tail = nullptr;
+        count = nodeCount = 0;
+    }
+
+    template<typename T, int K, typename Allocator>
+    typename UnrolledLinkedList<T, K, Allocator>::Node* UnrolledLinkedList<T, K, Allocator>::createNode() {
+        Node* node = NodeAllocatorTraits::allocate(allocator, 1);
+        NodeAllocatorTraits::construct(allocator, node);
+        nodeCount++;
+        return node;
+    }
+
+    template<typename T, int K, typename Allocator>
+    void UnrolledLinkedList<T, K, Allocator>::destroyNode(Node* node) {
+        if constexpr (!std::is_trivially_destructible<T>::value) {
+            T* elements = node->elements();
+            for (int i = 0; i < node->count; i++) {
+                elements[i].~T();
+            }
+        }
+        NodeAllocatorTraits::destroy(allocator, node);
+        NodeAllocatorTraits::deallocate(allocator, node, 1);
+        nodeCount--;
+    }
+
+    template<typename T, int K, typename Allocator>
+    typename UnrolledLinkedList<T, K, Allocator>::Node* UnrolledLinkedList<T, K, Allocator>::findNode(int& index, Node*& previous) const {
+        /*
+        Algorithm to find the node holding index (0 <= index < size):
+            -> Skip whole nodes, subtracting each node's element count from index
+            -> Stop at the first node whose count is larger than what is left of index
+            -> Time Complexity: O(n / K), Space Complexity: O(1)
+        */
+        previous = nullptr;
+        Node* current = head;
+        while (index >= current->count) {
+            index -= current->count;
+            previous = current;
+            current = current->next;
+        }
+        return current;
+    }
+
+    template<typename T, int K, typename Allocator>
+    typename UnrolledLinkedList<T, K, Allocator>::Node* UnrolledLinkedList<T, K, Allocator>::splitNode(Node* node) {
+        /*
+        Algorithm to split a full node:
+            -> Create a new node and link it after node (it becomes the tail if node was)
+            -> Move the upper half of node's elements into it, node keeps the lower K / 2
+            -> Time Complexity: O(K), Space Complexity: O(1)
+        */
+        Node* fresh = createNode();
+        T* from = node->elements();
+        T* to = fresh->elements();
+        for (int i = MIN_FILL; i < node->count; i++) {
+            new (&to[i - MIN_FILL]) T(std::move(from[i]));
+            from[i].~T();
+        }
+        fresh->count = node->count - MIN_FILL;
+        node->count = MIN_FILL;
+
+        fresh->next = node->next;
+        node->next = fresh;
+        if (tail == node) {
+            tail = fresh;
+        }
+        return fresh;
+    }
+
+    template<typename T, int K, typename Allocator>
+    void UnrolledLinkedList<T, K, Allocator>::insertInto(Node* node, int offset, T value) {
+        /*
+        Algorithm to insert inside a node:
+            -> If the node is full, split it and continue in whichever half offset falls into
+            -> Shift the elements [offset, count) one slot right (the last one into the
+               uninitialized slot at count) and place value at offset
+            -> Time Complexity: O(K), Space Complexity: O(1)
+        */
+        if (node->count == K) {
+            Node* fresh = splitNode(node);
+            if (offset > node->count) {
+                offset -= node->count;
+                node = fresh;
+            }
+        }
+        T* elements = node->elements();
+        if (offset == node->count) {
+            new (&elements[offset]) T(std::move(value));
+        } else {
+            new (&elements[node->count]) T(std::move(elements[node->count - 1]));
+            for (int i = node->count - 1; i > offset; i--) {
+                elements[i] = std::move(elements[i - 1]);
+            }
+            elements[offset] = std::move(value);
+        }
+        node->count++;
+        count++;
+    }
+
+    template<typename T, int K, typename Allocator>
+    T UnrolledLinkedList<T, K, Allocator>::removeFrom(Node* node, Node* previous, int offset) {
+        /*
+        Algorithm to remove inside a node:
+            -> Move the value out, shift [offset + 1, count) one slot left and destroy the last slot
+            -> Rebalance the node, which may now be underfull or empty
+            -> Time Complexity: O(K), Space Complexity: O(1)
+        */
+        T* elements = node->elements();
+        T value = std::move(elements[offset]);
+        for (int i = offset; i < node->count - 1; i++) {
+            elements[i] = std::move(elements[i + 1]);
+        }
+        elements[node->count - 1].~T();
+        node->count--;
+        count--;
+        rebalance(node, previous);
+        return value;
+    }
+
+    template<typename T, int K, typename Allocator>
+    void UnrolledLinkedList<T, K, Allocator>::rebalance(Node* node, Node* previous) {
+        /*
+        Algorithm to rebalance a node after a removal:
+            -> Empty node: unlink it from previous (or head) and free it, fixing tail
+            -> Node less than half full with a successor:
+                -> if both fit in one node, merge: move the successor's elements to
+                   the end of node and free the successor
+                -> otherwise refill: move just enough elements from the front of the
+                   successor to make node half full (the successor stays at least half full)
+            -> Time Complexity: O(K), Space Complexity: O(1)
+        */
+        if (node->count == 0) {
+            if (previous != nullptr) {
+                previous->next = node->next;
+            } else {
+                head = node->next;
+            }
+            if (tail == node) {
+                tail = previous;
+            }
+            destroyNode(node);
+            return;
+        }
+        Node* successor = node->next;
+        if (node->count >= MIN_FILL || successor == nullptr) {
+            return;
+        }
+
+        T* to = node->elements();
+        T* from = successor->elements();
+        if (node->count + successor->count <= K) {
+            for (int i = 0; i < successor->count; i++) {
+                new (&to[node->count + i]) T(std::move(from[i]));
+                from[i].~T();
+            }
+            node->count += successor->count;
+            successor->count = 0;
+            node->next = successor->next;
+            if (tail == successor) {
+                tail = node;
+            }
+            destroyNode(successor);
+        } else {
+            int take = MIN_FILL - node->count;
+            for (int i = 0; i < take; i++) {
+                new (&to[node->count + i]) T(std::move(from[i]));
+            }
+            for (int i = take; i < successor->count; i++) {
+                from[i - take] = std::move(from[i]);
+            }
+            for (int i = successor->count - take; i < successor->count; i++) {
+                from[i].~T();
+            }
+            node->count += take;
+            successor->count -= take;
+        }
+    }
+
+    template<typename T, int K, typename Allocator>
+    void UnrolledLinkedList<T, K, Allocator>::insertAtBeginning(T value) {
+        /*
+        Algorithm to implement insertAtBeginning:
+            -> If the list is empty, create its first node
+            -> Insert the value at offset 0 of the head node; a full head is split like any
+               other node instead of getting a new 1-element node in front of it, so the
+               head stays at least half full
+            -> Time Complexity: O(K), Space Complexity: O(1)
+        */
+        if (head == nullptr) {
+            head = tail = createNode();
+        }
+        insertInto(head, 0, std::move(value));
+    }
+
+    template<typename T, int K, typename Allocator>
+    void UnrolledLinkedList<T, K, Allocator>::insertAtEnd(T value) {
+        /*
+        Algorithm to insert at the end of the list:
+            -> If the list is empty or the tail node is full, link a new empty node after it
+               (appending never splits, so a sequentially built list has full nodes)
+            -> Place the value after the tail node's last element
+            -> Time Complexity: O(1), Space Complexity: O(1)
+        */
+        if (tail == nullptr || tail->count == K) {
+            Node* fresh = createNode();
+            if (tail == nullptr) {
+                head = fresh;
+            } else {
+                tail->next = fresh;
+            }
+            tail = fresh;
+        }
+        insertInto(tail, tail->count, std::move(value));
+    }
+
+    template<typename T, int K, typename Allocator>
+    void UnrolledLinkedList<T, K, Allocator>::insertAt(int index, T value) {
+        /*
+        Algorithm to implement insert at specified index:
+            -> Check the index is within [0, size]
+            -> index 0 or size: insert at the beginning or end
+            -> Otherwise find the node holding index and insert inside it (splitting it if full)
+            -> Time Complexity: O(n / K + K), Space Complexity: O(1)
+        */
+        if (index < 0 || index > count) {
+            throw std::out_of_range("Index out of bounds");
+        }
+        if (index == 0) {
+            insertAtBeginning(std::move(value));
+            return;
+        }
+        if (index == count) {
+            insertAtEnd(std::move(value));
+            return;
+        }
+        Node* previous;
+        Node* node = findNode(index, previous);
+        insertInto(node, index, std::move(value));
+    }
+
+    template<typename T, int K, typename Allocator>
+    void UnrolledLinkedList<T, K, Allocator>::set(int index, T value) {
+        if (index < 0 || index >= count) {
+            throw std::out_of_range("Index out of bounds");
+        }
+        Node* previous;
+        Node* node = findNode(index, previous);
+        node->elements()[index] = std::move(value);
+    }
+
+    template<typename T, int K, typename Allocator>
+    T UnrolledLinkedList<T, K, Allocator>::get(int index) const {
+        // skips whole nodes, Time Complexity: O(n / K)
+        if (index < 0 || index >= count) {
+            throw std::out_of_range("Index out of range");
+        }
+        Node* previous;
+        Node* node = findNode(index, previous);
+        return node->elements()[index];
+    }
+
+    template<typename T, int K, typename Allocator>
+    T UnrolledLinkedList<T, K, Allocator>::removeFirst() {
+        if (head == nullptr) {
+            throw std::out_of_range("Cannot delete from empty linked list");
+        }
+        return removeFrom(head, nullptr, 0);
+    }
+
+    template<typename T, int K, typename Allocator>
+    T UnrolledLinkedList<T, K, Allocator>::removeLast() {
+        /*
+        Algorithm to implement removeLast:
+            -> Check if the list is empty; if so, throw an exception
+            -> Remove the last element of the tail node; only if that empties the
+               node is the node before it needed, so only then walk the nodes
+            -> Time Complexity: O(1), O(n / K) once every K removals, Space Complexity: O(1)
+        */
+        if (tail == nullptr) {
+            throw std::out_of_range("Cannot delete from empty linked list");
+        }
+        Node* previous = nullptr;
+        if (tail->count == 1) {
+            for (Node* current = head; current != tail; current = current->next) {
+                previous = current;
+            }
+        }
+        return removeFrom(tail, previous, tail->count - 1);
+    }
+
+    template<typename T, int K, typename Allocator>
+    T UnrolledLinkedList<T, K, Allocator>::removeAt(int index) {
+        /*
+        Algorithm to implement remove at specified index:
+            -> Check the list is not empty and the index is within [0, size)
+            -> Find the node holding index and remove inside it (merging or refilling it if underfull)
+            -> Time Complexity: O(n / K + K), Space Complexity: O(1)
+        */
+        if (head == nullptr) {
+            throw std::out_of_range("Cannot delete from empty linked list");
+        }
+        if (index < 0 || index >= count) {
+            throw std::out_of_range("Index out of bounds");
+        }
+        Node* previous;
+        Node* node = findNode(index, previous);
+        return removeFrom(node, previous, index);
+    }
+
+    template<typename T, int K, typename Allocator>
+    int UnrolledLinkedList<T, K, Allocator>::linearSearch(T value) const {
+        /*
+        Algorithm to implement linearSearch:
+            -> For each node, scan its elements as a plain array
+            -> Return the global index of the first match, or -1
+            -> Time Complexity: O(n), one pointer hop per K elements, Space Complexity: O(1)
+        */
+        int base = 0;
+        for (Node* current = head; current != nullptr; current = current->next) {
+            const T* elements = current->elements();
+            for (int i = 0; i < current->count; i++) {
+                if (elements[i] == value) {
+                    return base + i;
+                }
+            }
+            base += current->count;
+        }
+        return -1;
+    }
+
+    template<typename T, int K, typename Allocator>
+    int UnrolledLinkedList<T, K, Allocator>::getSize() const { return count; }
+
+    template<typename T, int K, typename Allocator>
+    int UnrolledLinkedList<T, K, Allocator>::getNodeCount() const { return nodeCount; }
+
+    template<typename T, int K, typename Allocator>
+    bool UnrolledLinkedList<T, K, Allocator>::isEmpty() const { return count == 0; }
+
+    template<typename T, int K, typename Allocator>
+    void UnrolledLinkedList<T, K, Allocator>::reverse() {
+        /* Algorithm to implement reverse:
+            -> Reverse the chain of nodes like LinkedList::reverse (the old head becomes the tail)
+            -> Reverse the elements inside every node
+            -> The old tail, which may be underfull, is now the head: rebalance it with its successor
+            -> Time Complexity: O(n), Space Complexity: O(1)
+        */
+        tail = head;
+        Node* prev = nullptr;
+        Node* current = head;
+        while (current != nullptr) {
+            Node* next = current->next;
+            current->next = prev;
+            std::reverse(current->elements(), current->elements() + current->count);
+            prev = current;
+            current = next;
+        }
+        head = prev;
+        if (head != nullptr) {
+            rebalance(head, nullptr);
+        }
+    }
+
+    template<typename T, int K, typename Allocator>
+    void UnrolledLinkedList<T, K, Allocator>::print() const {
+        for (Node* current = head; current != nullptr; current = current->next) {
+            const T* elements = current->elements();
+            for (int i = 0; i < current->count; i++) {
+                std::cout << elements[i] << " ";
+            }
+        }
+    }
+
+    template<typename T, int K, typename Allocator>
+    Allocator UnrolledLinkedList<T, K, Allocator>::getAllocator() const {
+        return Allocator(allocator);
+    }
+}
\ No newline at end of file
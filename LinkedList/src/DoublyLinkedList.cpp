@@ -0,0 +1,11 @@
+// Precompiled instantiations for the DSA_EXPLICIT_INSTANTIATION build.
+// The header-only build does not compile this file.
+#include "DoublyLinkedList.h"
+#include <string>
+
+// Explicit template instantiation for common types
+template class dsa::DoublyLinkedList<int>;
+template class dsa::DoublyLinkedList<double>;
+template class dsa::DoublyLinkedList<float>;
+template class dsa::DoublyLinkedList<char>;
+template class dsa::DoublyLinkedList<std::string>;
\ No newline at end of file
@@ -0,0 +1,11 @@
+// Precompiled instantiations for the DSA_EXPLICIT_INSTANTIATION build.
+// The header-only build does not compile this file.
+#include "SkipList.h"
+#include <string>
+
+// Explicit template instantiation for common types
+template class dsa::SkipList<int>;
+template class dsa::SkipList<double>;
+template class dsa::SkipList<float>;
+template class dsa::SkipList<char>;
+template class dsa::SkipList<std::string>;
\ No newline at end of file
@@ -0,0 +1,11 @@
+// Precompiled instantiations for the DSA_EXPLICIT_INSTANTIATION build.
+// The header-only build does not compile this file.
+#include "UnrolledLinkedList.h"
+#include <string>
+
+// Explicit template instantiation for common types
+template class dsa::UnrolledLinkedList<int>;
+template class dsa::UnrolledLinkedList<double>;
+template class dsa::UnrolledLinkedList<float>;
+template class dsa::UnrolledLinkedList<char>;
+template class dsa::UnrolledLinkedList<std::string>;
\ No newline at end of file
@@ -1,5 +1,15 @@
 #include <iostream>
 #include "LinkedList.h"
+#include "DoublyLinkedList.h"
+#include "UnrolledLinkedList.h"
+#include "SkipList.h"
+#include "IntrusiveList.h"
+
+// Object that can sit in an IntrusiveList through its hook
+struct Task {
+    int id;
+    dsa::IntrusiveListHook<Task> hook;
+};
 
 int main() {
     dsa::LinkedList<int> list;
@@ -62,6 +72,16 @@ int main() {
     list.print();
     std::cout << std::endl;
 
+    // Test mergeSort with a comparator
+    list.mergeSort([](int a, int b) { return a > b; });
+    std::cout << "After mergeSort (descending): ";
+    list.print();
+    std::cout << std::endl;
+    list.mergeSort();
+    std::cout << "After mergeSort (ascending): ";
+    list.print();
+    std::cout << std::endl;
+
     // Test reverse
     std::cout << "Reversing: ";
     list.reverse();
@@ -79,11 +99,131 @@ int main() {
         std::cout << "Caught exception: " << e.what() << std::endl;
     }
 
+    // Iterate once instead of calling get(i) in a loop
+    std::cout << "Iterated:";
+    for (int value : list) {
+        std::cout << " " << value;
+    }
+    std::cout << std::endl;
+
+    // Edit during a single pass: drop the 20, double everything else and insert 1 after it
+    auto cursor = list.cursor();
+    while (cursor.hasNext()) {
+        if (cursor.peekNext() == 20) {
+            cursor.eraseAfter();
+        } else {
+            cursor.advance();
+            cursor.current() *= 2;
+            cursor.insertAfter(1);
+            cursor.advance();
+        }
+    }
+    std::cout << "After cursor edits: ";
+    list.print();
+    std::cout << std::endl;
+
     // Clear the list
     while (!list.isEmpty()) {
         list.removeFirst();
     }
     std::cout << "After clearing, size: " << list.getSize() << std::endl;
 
+    // Nodes drawn from a monotonic arena: no per-node frees, one release for the whole list
+    dsa::MonotonicArena arena;
+    {
+        dsa::LinkedList<int, dsa::ArenaAllocator<int>> arenaList{dsa::ArenaAllocator<int>(arena)};
+        for (int i = 1; i <= 5; i++) {
+            arenaList.insertAtEnd(i * 10);
+        }
+        std::cout << "Arena-backed list: ";
+        arenaList.print();
+        std::cout << std::endl;
+    }
+    arena.release();
+
+    // Splice, split and merge relink nodes of lists sharing one pool
+    dsa::PoolAllocator<int> pool;
+    dsa::LinkedList<int> evens(pool);
+    dsa::LinkedList<int> odds(pool);
+    for (int i = 0; i < 5; i++) {
+        evens.insertAtEnd(2 * i);
+        odds.insertAtEnd(2 * i + 1);
+    }
+    evens.merge(std::move(odds));
+    std::cout << "Merged: ";
+    evens.print();
+    std::cout << std::endl;
+    dsa::LinkedList<int> upper = evens.splitAt(6);
+    std::cout << "splitAt(6): ";
+    evens.print();
+    std::cout << "| ";
+    upper.print();
+    std::cout << std::endl;
+    upper.splice(std::move(evens));
+    std::cout << "Spliced back: ";
+    upper.print();
+    std::cout << "(" << upper.getSize() << " elements)" << std::endl;
+
+    // Doubly linked list: O(1) removeLast and backward traversal
+    dsa::DoublyLinkedList<int> doubly;
+    for (int i = 1; i <= 5; i++) {
+        doubly.insertAtEnd(i);
+    }
+    std::cout << "Doubly linked list: ";
+    doubly.print();
+    std::cout << std::endl << "Backwards: ";
+    doubly.printReverse();
+    std::cout << std::endl;
+    std::cout << "removeLast: " << doubly.removeLast() << ", get(3): " << doubly.get(3) << std::endl;
+    doubly.reverse();
+    std::cout << "Reversed with iterators:";
+    for (int value : doubly) {
+        std::cout << " " << value;
+    }
+    std::cout << std::endl;
+
+    // Unrolled linked list: up to 4 elements per node, split and merged as the list changes
+    dsa::UnrolledLinkedList<int, 4> unrolled;
+    for (int i = 1; i <= 10; i++) {
+        unrolled.insertAtEnd(i);
+    }
+    unrolled.insertAt(2, 99); // splits the full first node
+    std::cout << "Unrolled list: ";
+    unrolled.print();
+    std::cout << "(" << unrolled.getNodeCount() << " nodes)" << std::endl;
+    unrolled.removeAt(0);
+    unrolled.removeAt(0);
+    std::cout << "After two removals: ";
+    unrolled.print();
+    std::cout << "(" << unrolled.getNodeCount() << " nodes), get(5): " << unrolled.get(5) << std::endl;
+
+    // Skip list: express links with widths give O(log n) positional and sorted access
+    dsa::SkipList<int> skip;
+    for (int value : {50, 10, 40, 20, 30}) {
+        skip.insertSorted(value);
+    }
+    std::cout << "Skip list (sorted inserts): ";
+    skip.print();
+    std::cout << std::endl;
+    std::cout << "binarySearch(40): " << skip.binarySearch(40) << ", binarySearch(35): " << skip.binarySearch(35) << std::endl;
+    skip.insertAt(2, 25);
+    std::cout << "After insertAt(2, 25): ";
+    skip.print();
+    std::cout << std::endl << "get(4): " << skip.get(4) << ", removeAt(0): " << skip.removeAt(0) << std::endl;
+
+    // Intrusive list: links existing Task objects through their hook, no allocation per element
+    Task tasks[4] = {{1, {}}, {2, {}}, {3, {}}, {4, {}}};
+    dsa::IntrusiveList<Task, &Task::hook> pending;
+    for (Task& task : tasks) {
+        pending.insertAtEnd(task);
+    }
+    pending.remove(tasks[1]);
+    pending.reverse();
+    std::cout << "Intrusive list after remove(task 2) and reverse:";
+    for (const Task& task : pending) {
+        std::cout << " " << task.id;
+    }
+    std::cout << std::endl;
+
     return 0;
 }
\ No newline at end of file
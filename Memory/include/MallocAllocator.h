@@ -0,0 +1,61 @@
+#pragma once
+#include <cstddef>
+#include <cstdlib>
+#include <limits>
+#include <new>
+#include <type_traits>
+
+namespace dsa {
+    /*
+    std::allocator-compatible allocator backed by malloc/free. It is Array's
+    default allocator: unlike std::allocator, blocks obtained from it can be
+    grown in place with realloc, which Array does for trivially copyable T.
+    malloc only guarantees alignof(std::max_align_t), so over-aligned T is
+    served by the aligned operator new instead (and never realloc'd).
+    */
+    template<typename T>
+    struct MallocAllocator {
+        using value_type = T;
+
+        MallocAllocator() noexcept = default;
+        template<typename U>
+        MallocAllocator(const MallocAllocator<U>&) noexcept {}
+
+        T* allocate(std::size_t count) {
+            if (count > std::numeric_limits<std::size_t>::max() / sizeof(T)) {
+                throw std::bad_array_new_length();
+            }
+            if constexpr (alignof(T) > alignof(std::max_align_t)) {
+                return static_cast<T*>(::operator new(count * sizeof(T), std::align_val_t(alignof(T))));
+            } else {
+                void* memory = std::malloc(count * sizeof(T));
+                if (memory == nullptr) {
+                    throw std::bad_alloc();
+                }
+                return static_cast<T*>(memory);
+            }
+        }
+
+        void deallocate(T* pointer, std::size_t) noexcept {
+            if constexpr (alignof(T) > alignof(std::max_align_t)) {
+                ::operator delete(pointer, std::align_val_t(alignof(T)));
+            } else {
+                std::free(pointer);
+            }
+        }
+    };
+
+    template<typename T, typename U>
+    bool operator==(const MallocAllocator<T>&, const MallocAllocator<U>&) noexcept { return true; }
+
+    template<typename T, typename U>
+    bool operator!=(const MallocAllocator<T>&, const MallocAllocator<U>&) noexcept { return false; }
+
+    // True for allocators whose blocks may be resized with std::realloc
+    // (MallocAllocator, except for over-aligned T, which does not come from malloc)
+    template<typename Allocator>
+    struct IsMallocAllocator : std::false_type {};
+
+    template<typename T>
+    struct IsMallocAllocator<MallocAllocator<T>> : std::integral_constant<bool, alignof(T) <= alignof(std::max_align_t)> {};
+}
\ No newline at end of file
@@ -0,0 +1,81 @@
+#pragma once
+#include <cstddef>
+#include <type_traits>
+
+namespace dsa {
+    /*
+    Monotonic (bump pointer) arena: allocations are carved out of large
+    malloc'd blocks and are never freed one by one. release() (or the
+    destructor) frees every block at once, so everything allocated for one
+    request can be torn down in O(number of blocks) instead of one free per
+    element. Not thread-safe.
+    */
+    class MonotonicArena {
+        private:
+            struct Block {
+                Block* next; // previously allocated block
+                std::size_t size; // usable bytes after the header
+            };
+
+            Block* blocks; // most recently allocated block (head of the block list)
+            char* cursor; // next free byte in the current block
+            char* limit; // one past the last byte of the current block
+            std::size_t nextBlockSize; // size of the next block, doubles after every block
+            std::size_t initialBlockSize; // block size to restart from after release()
+            std::size_t bytesReserved; // total bytes obtained from malloc
+
+            void addBlock(std::size_t minimumBytes); // allocates a new current block with room for minimumBytes
+
+        public:
+            explicit MonotonicArena(std::size_t initialBlockSize = 4096); // Constructor, allocates nothing until first use
+            MonotonicArena(const MonotonicArena&) = delete;
+            MonotonicArena& operator=(const MonotonicArena&) = delete;
+            ~MonotonicArena(); // Frees every block
+
+            void* allocate(std::size_t bytes, std::size_t alignment); // Returns bytes of storage aligned to alignment
+            void release(); // Frees every block at once; everything allocated from the arena becomes invalid
+            std::size_t getBytesReserved() const; // Returns the number of bytes currently held from malloc
+    };
+
+    /*
+    std::allocator-compatible handle to a MonotonicArena. deallocate() is a
+    no-op; memory comes back only when the arena is released. Containers keep
+    the allocator they were constructed with (it is not propagated on copy,
+    move or swap), like std::pmr::polymorphic_allocator.
+    */
+    template<typename T>
+    class ArenaAllocator {
+        private:
+            MonotonicArena* arena; // not owned
+
+            template<typename U>
+            friend class ArenaAllocator;
+
+        public:
+            using value_type = T;
+
+            ArenaAllocator(MonotonicArena& arena) noexcept; // Allocates from arena
+            template<typename U>
+            ArenaAllocator(const ArenaAllocator<U>& other) noexcept; // Rebinding constructor
+
+            T* allocate(std::size_t count); // Bump-allocates count elements from the arena
+            void deallocate(T* pointer, std::size_t count) noexcept; // No-op
+            MonotonicArena* getArena() const noexcept; // Returns the arena this allocator draws from
+    };
+
+    template<typename T, typename U>
+    bool operator==(const ArenaAllocator<T>& a, const ArenaAllocator<U>& b) noexcept;
+
+    template<typename T, typename U>
+    bool operator!=(const ArenaAllocator<T>& a, const ArenaAllocator<U>& b) noexcept;
+
+    // True for allocators whose deallocate() is a no-op, so containers of
+    // trivially destructible elements may skip walking their nodes on destruction
+    template<typename Allocator>
+    struct IsMonotonicAllocator : std::false_type {};
+
+    template<typename T>
+    struct IsMonotonicAllocator<ArenaAllocator<T>> : std::true_type {};
+}
+
+#include "MonotonicArena.tpp"
\ No newline at end of file
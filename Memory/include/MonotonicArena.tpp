@@ -0,0 +1,105 @@
+#pragma once
+// Definitions for MonotonicArena.h (included at the end of MonotonicArena.h)
+#include <cstdint>
+#include <cstdlib>
+#include <new>
+
+namespace dsa {
+    inline MonotonicArena::MonotonicArena(std::size_t initialBlockSize)
+        : blocks(nullptr), cursor(nullptr), limit(nullptr),
+          nextBlockSize(initialBlockSize > 0 ? initialBlockSize : 1),
+          initialBlockSize(initialBlockSize > 0 ? initialBlockSize : 1), bytesReserved(0) {}
+
+    inline MonotonicArena::~MonotonicArena() {
+        release();
+    }
+
+    inline void MonotonicArena::addBlock(std::size_t minimumBytes) {
+        /*
+        Algorithm to add a block:
+            1. take the next geometric block size, or minimumBytes if that is larger
+            2. malloc the block header plus the usable bytes and push it on the block list
+            3. point cursor/limit at the usable bytes and double the next block size
+        */
+        std::size_t size = (nextBlockSize > minimumBytes) ? nextBlockSize : minimumBytes;
+        void* memory = std::malloc(sizeof(Block) + size);
+        if (memory == nullptr) {
+            throw std::bad_alloc();
+        }
+        Block* block = static_cast<Block*>(memory);
+        block->next = blocks;
+        block->size = size;
+        blocks = block;
+        cursor = reinterpret_cast<char*>(block + 1);
+        limit = cursor + size;
+        bytesReserved += sizeof(Block) + size;
+        nextBlockSize *= 2;
+    }
+
+    inline void* MonotonicArena::allocate(std::size_t bytes, std::size_t alignment) {
+        /*
+        Algorithm to allocate from the arena:
+            1. round cursor up to the requested alignment
+            2. if the current block is too small, start a new block big enough
+               for bytes plus worst-case alignment padding and align again
+            3. bump cursor past the allocation and return the aligned address
+        */
+        std::uintptr_t address = reinterpret_cast<std::uintptr_t>(cursor);
+        std::uintptr_t aligned = (address + alignment - 1) & ~static_cast<std::uintptr_t>(alignment - 1);
+        if (cursor == nullptr || aligned + bytes > reinterpret_cast<std::uintptr_t>(limit)) {
+            addBlock(bytes + alignment);
+            address = reinterpret_cast<std::uintptr_t>(cursor);
+            aligned = (address + alignment - 1) & ~static_cast<std::uintptr_t>(alignment - 1);
+        }
+        cursor = reinterpret_cast<char*>(aligned + bytes);
+        return reinterpret_cast<void*>(aligned);
+    }
+
+    inline void MonotonicArena::release() {
+        // one free per block, regardless of how many objects were allocated
+        while (blocks != nullptr) {
+            Block* next = blocks->next;
+            std::free(blocks);
+            blocks = next;
+        }
+        cursor = limit = nullptr;
+        nextBlockSize = initialBlockSize;
+        bytesReserved = 0;
+    }
+
+    inline std::size_t MonotonicArena::getBytesReserved() const {
+        return bytesReserved;
+    }
+
+    template<typename T>
+    ArenaAllocator<T>::ArenaAllocator(MonotonicArena& arena) noexcept : arena(&arena) {}
+
+    template<typename T>
+    template<typename U>
+    ArenaAllocator<T>::ArenaAllocator(const ArenaAllocator<U>& other) noexcept : arena(other.arena) {}
+
+    template<typename T>
+    T* ArenaAllocator<T>::allocate(std::size_t count) {
+        return static_cast<T*>(arena->allocate(count * sizeof(T), alignof(T)));
+    }
+
+    template<typename T>
+    void ArenaAllocator<T>::deallocate(T*, std::size_t) noexcept {
+        // monotonic: memory is reclaimed all at once by MonotonicArena::release()
+    }
+
+    template<typename T>
+    MonotonicArena* ArenaAllocator<T>::getArena() const noexcept {
+        return arena;
+    }
+
+    template<typename T, typename U>
+    bool operator==(const ArenaAllocator<T>& a, const ArenaAllocator<U>& b) noexcept {
+        return a.getArena() == b.getArena();
+    }
+
+    template<typename T, typename U>
+    bool operator!=(const ArenaAllocator<T>& a, const ArenaAllocator<U>& b) noexcept {
+        return !(a == b);
+    }
+}
\ No newline at end of file
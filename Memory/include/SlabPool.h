@@ -0,0 +1,88 @@
+#pragma once
+#include <cstddef>
+#include <memory>
+
+namespace dsa {
+    /*
+    Slab pool of fixed-size slots. Slots are carved out of contiguous blocks,
+    so objects allocated one after another sit next to each other in memory.
+    Freed slots go on an intrusive free list and are handed out again (most
+    recently freed first) before the pool asks malloc for a new block; blocks
+    are only returned by release() or the destructor. The slot size and
+    alignment are fixed by the first allocation (or by the constructor).
+    Not thread-safe.
+    */
+    class SlabPool {
+        private:
+            struct FreeSlot {
+                FreeSlot* next; // next free slot
+            };
+
+            struct Block {
+                Block* previous; // previously allocated block
+            };
+
+            static constexpr std::size_t FIRST_BLOCK_SLOTS = 16; // slots in the first block
+            static constexpr std::size_t MAX_BLOCK_SLOTS = 4096; // blocks stop doubling at this many slots
+
+            std::size_t slotSize; // bytes per slot, 0 until the pool is configured
+            std::size_t slotAlignment; // alignment of every slot
+            Block* blocks; // most recently allocated block
+            FreeSlot* freeList; // slots handed back by deallocate()
+            char* cursor; // next never-used slot in the current block
+            char* limit; // one past the last slot of the current block
+            std::size_t nextBlockSlots; // slots in the next block
+
+            void addBlock(); // allocates the next block and makes it current
+            std::size_t headerSize() const; // block header size rounded up to the slot alignment
+
+        public:
+            SlabPool(); // Constructor, slot size is taken from the first allocation
+            SlabPool(std::size_t slotSize, std::size_t slotAlignment); // Constructor with a fixed slot size
+            SlabPool(const SlabPool&) = delete;
+            SlabPool& operator=(const SlabPool&) = delete;
+            ~SlabPool(); // Frees every block
+
+            bool fits(std::size_t size, std::size_t alignment); // True if objects of this size/alignment are served from slots (configures an unconfigured pool)
+            void* allocate(); // Returns one uninitialized slot
+            void deallocate(void* slot); // Puts a slot back on the free list in O(1)
+            void release(); // Frees every block; all slots handed out become invalid
+            std::size_t getSlotSize() const; // Returns the slot size in bytes (0 if not configured yet)
+    };
+
+    /*
+    std::allocator-compatible handle to a shared SlabPool. Single-object
+    allocations (list nodes) come from the pool, larger requests go to
+    operator new. A default-constructed PoolAllocator creates a new pool;
+    copies and rebound copies share it, compare equal and may free each
+    other's memory. The pool lives as long as any allocator referring to it.
+    */
+    template<typename T>
+    class PoolAllocator {
+        private:
+            std::shared_ptr<SlabPool> pool; // shared by every copy of this allocator
+
+            template<typename U>
+            friend class PoolAllocator;
+
+        public:
+            using value_type = T;
+
+            PoolAllocator(); // Allocates from a new pool of its own
+            explicit PoolAllocator(std::shared_ptr<SlabPool> pool); // Allocates from an existing pool
+            template<typename U>
+            PoolAllocator(const PoolAllocator<U>& other) noexcept; // Rebinding constructor, shares the pool
+
+            T* allocate(std::size_t count); // One T from the pool, count > 1 (or an over-aligned T) from operator new
+            void deallocate(T* pointer, std::size_t count) noexcept; // Back to the pool's free list (or operator delete)
+            const std::shared_ptr<SlabPool>& getPool() const noexcept; // Returns the shared pool
+    };
+
+    template<typename T, typename U>
+    bool operator==(const PoolAllocator<T>& a, const PoolAllocator<U>& b) noexcept;
+
+    template<typename T, typename U>
+    bool operator!=(const PoolAllocator<T>& a, const PoolAllocator<U>& b) noexcept;
+}
+
+#include "SlabPool.tpp"
\ No newline at end of file
@@ -0,0 +1,155 @@
+#pragma once
+// Definitions for SlabPool.h (included at the end of SlabPool.h)
+#include <cstdlib>
+#include <new>
+
+namespace dsa {
+    inline SlabPool::SlabPool()
+        : slotSize(0), slotAlignment(alignof(FreeSlot)), blocks(nullptr), freeList(nullptr),
+          cursor(nullptr), limit(nullptr), nextBlockSlots(FIRST_BLOCK_SLOTS) {}
+
+    inline SlabPool::SlabPool(std::size_t slotSize, std::size_t slotAlignment) : SlabPool() {
+        fits(slotSize, slotAlignment);
+    }
+
+    inline SlabPool::~SlabPool() {
+        release();
+    }
+
+    inline std::size_t SlabPool::headerSize() const {
+        return (sizeof(Block) + slotAlignment - 1) / slotAlignment * slotAlignment;
+    }
+
+    inline bool SlabPool::fits(std::size_t size, std::size_t alignment) {
+        /*
+        Algorithm to check whether an object is served from slots:
+            1. unconfigured pool: adopt the size (at least a free list link, rounded
+               up to the alignment) and alignment, unless the alignment exceeds what
+               malloc guarantees
+            2. configured pool: the object must fit in a slot and need no stricter alignment
+        */
+        if (slotSize == 0) {
+            if (alignment > alignof(std::max_align_t)) {
+                return false;
+            }
+            slotAlignment = (alignment > alignof(FreeSlot)) ? alignment : alignof(FreeSlot);
+            std::size_t bytes = (size > sizeof(FreeSlot)) ? size : sizeof(FreeSlot);
+            slotSize = (bytes + slotAlignment - 1) / slotAlignment * slotAlignment;
+            return true;
+        }
+        return size <= slotSize && alignment <= slotAlignment;
+    }
+
+    inline void SlabPool::addBlock() {
+        /*
+        Algorithm to add a block:
+            1. malloc a header plus nextBlockSlots contiguous slots
+            2. link the block in front of the block list
+            3. make its slots the current bump range
+            4. double nextBlockSlots, up to MAX_BLOCK_SLOTS
+        */
+        void* memory = std::malloc(headerSize() + nextBlockSlots * slotSize);
+        if (memory == nullptr) {
+            throw std::bad_alloc();
+        }
+        Block* block = static_cast<Block*>(memory);
+        block->previous = blocks;
+        blocks = block;
+        cursor = static_cast<char*>(memory) + headerSize();
+        limit = cursor + nextBlockSlots * slotSize;
+        if (nextBlockSlots < MAX_BLOCK_SLOTS) {
+            nextBlockSlots *= 2;
+        }
+    }
+
+    inline void* SlabPool::allocate() {
+        /*
+        Algorithm to allocate a slot:
+            1. free list not empty: pop its head (the most recently freed, likely still cached)
+            2. otherwise take the next slot of the current block, adding a block when it is used up
+        */
+        if (freeList != nullptr) {
+            FreeSlot* slot = freeList;
+            freeList = slot->next;
+            return slot;
+        }
+        if (cursor == limit) {
+            addBlock();
+        }
+        void* slot = cursor;
+        cursor += slotSize;
+        return slot;
+    }
+
+    inline void SlabPool::deallocate(void* slot) {
+        FreeSlot* freed = static_cast<FreeSlot*>(slot);
+        freed->next = freeList;
+        freeList = freed;
+    }
+
+    inline void SlabPool::release() {
+        // one free per block, regardless of how many slots were handed out
+        while (blocks != nullptr) {
+            Block* previous = blocks->previous;
+            std::free(blocks);
+            blocks = previous;
+        }
+        freeList = nullptr;
+        cursor = limit = nullptr;
+        nextBlockSlots = FIRST_BLOCK_SLOTS;
+    }
+
+    inline std::size_t SlabPool::getSlotSize() const {
+        return slotSize;
+    }
+
+    template<typename T>
+    PoolAllocator<T>::PoolAllocator() : pool(std::make_shared<SlabPool>()) {}
+
+    template<typename T>
+    PoolAllocator<T>::PoolAllocator(std::shared_ptr<SlabPool> pool) : pool(std::move(pool)) {}
+
+    template<typename T>
+    template<typename U>
+    PoolAllocator<T>::PoolAllocator(const PoolAllocator<U>& other) noexcept : pool(other.pool) {}
+
+    template<typename T>
+    T* PoolAllocator<T>::allocate(std::size_t count) {
+        if (count == 1 && pool->fits(sizeof(T), alignof(T))) {
+            return static_cast<T*>(pool->allocate());
+        }
+        // operator new only guarantees the default alignment, over-aligned T needs the aligned overload
+        if constexpr (alignof(T) > __STDCPP_DEFAULT_NEW_ALIGNMENT__) {
+            return static_cast<T*>(::operator new(count * sizeof(T), std::align_val_t(alignof(T))));
+        } else {
+            return static_cast<T*>(::operator new(count * sizeof(T)));
+        }
+    }
+
+    template<typename T>
+    void PoolAllocator<T>::deallocate(T* pointer, std::size_t count) noexcept {
+        // the pool is configured by now, so fits() gives the same answer as in allocate()
+        if (count == 1 && pool->fits(sizeof(T), alignof(T))) {
+            pool->deallocate(pointer);
+        } else if constexpr (alignof(T) > __STDCPP_DEFAULT_NEW_ALIGNMENT__) {
+            ::operator delete(pointer, std::align_val_t(alignof(T)));
+        } else {
+            ::operator delete(pointer);
+        }
+    }
+
+    template<typename T>
+    const std::shared_ptr<SlabPool>& PoolAllocator<T>::getPool() const noexcept {
+        return pool;
+    }
+
+    template<typename T, typename U>
+    bool operator==(const PoolAllocator<T>& a, const PoolAllocator<U>& b) noexcept {
+        return a.getPool() == b.getPool();
+    }
+
+    template<typename T, typename U>
+    bool operator!=(const PoolAllocator<T>& a, const PoolAllocator<U>& b) noexcept {
+        return !(a == b);
+    }
+}
\ No newline at end of file
@@ -0,0 +1,50 @@
+#include <cstdint>
+#include <iostream>
+#include <vector>
+#include "MallocAllocator.h"
+#include "MonotonicArena.h"
+#include "SlabPool.h"
+
+using namespace std;
+using namespace dsa;
+
+int main() {
+    cout << "=== MonotonicArena ===" << endl;
+
+    MonotonicArena arena(256);
+    cout << "Bytes reserved before use: " << arena.getBytesReserved() << endl;
+
+    // The allocators are std::allocator-compatible, so standard containers accept them too
+    vector<int, ArenaAllocator<int>> numbers{ArenaAllocator<int>(arena)};
+    for (int i = 1; i <= 100; i++) {
+        numbers.push_back(i * i);
+    }
+    cout << "numbers[99] = " << numbers[99] << endl;
+    cout << "Bytes reserved after 100 push_backs: " << arena.getBytesReserved() << endl;
+
+    double* values = ArenaAllocator<double>(arena).allocate(4);
+    cout << "Arena allocation aligned for double: "
+         << ((reinterpret_cast<uintptr_t>(values) % alignof(double)) == 0 ? "Yes" : "No") << endl;
+
+    numbers = vector<int, ArenaAllocator<int>>(ArenaAllocator<int>(arena));
+    arena.release();
+    cout << "Bytes reserved after release(): " << arena.getBytesReserved() << endl;
+    cout << endl;
+
+    cout << "=== SlabPool ===" << endl;
+
+    SlabPool pool(sizeof(long long), alignof(long long));
+    long long* first = static_cast<long long*>(pool.allocate());
+    long long* second = static_cast<long long*>(pool.allocate());
+    cout << "Consecutive slots adjacent: " << (second == first + 1 ? "Yes" : "No") << endl;
+    pool.deallocate(first);
+    cout << "Freed slot reused: " << (pool.allocate() == first ? "Yes" : "No") << endl;
+    cout << endl;
+
+    cout << "=== MallocAllocator ===" << endl;
+
+    vector<int, MallocAllocator<int>> heapNumbers = {3, 1, 2};
+    cout << "heapNumbers size: " << heapNumbers.size() << endl;
+
+    return 0;
+}
\ No newline at end of file
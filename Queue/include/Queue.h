@@ -1,22 +1,58 @@
 #pragma once
 #include "../../Array/include/Array.h"
+#include "../../Array/include/SmallArray.h"
+#include <type_traits>
+#include <utility>
 
 namespace dsa {
-    template<typename T>
+    // Storage is the ring buffer's backing array: Array<T> by default, or e.g.
+    // SmallArray<T, 8> to keep the first 8 slots off the heap
+    template<typename T, typename Storage = Array<T>>
     class Queue {
         private:
-            Array<T> queue;
+            Storage queue; // ring buffer slots, always filled up to capacity
             int frontIndex; // Points to the front element in the queue
             int rearIndex; // Points to the rear element in the queue
+            int count; // Number of elements currently in the queue
+            int capacity; // Number of slots in the ring buffer (always a power of two)
+
+            void grow(); // doubles the ring buffer capacity and unwraps the elements
+            void resetIndices(); // back to the state of an empty queue without slots
+            int wrap(int index) const; // maps an index onto the ring buffer (index & (capacity - 1))
+            template<typename... Args>
+            void constructInSlot(int slot, Args&&... args); // replaces the default element in slot with T(args...), built in place
         
         public:
             Queue(); // Constructor
-            void enqueue(T value); // Add element at the rear of the queue
+            Queue(const Queue& other) = default; // Copy constructor (deep copy of the ring buffer)
+            Queue(Queue&& other) noexcept(std::is_nothrow_move_constructible<Storage>::value); // Move constructor, leaves other empty
+            Queue& operator=(const Queue& other) = default; // Copy assignment (deep copy of the ring buffer)
+            Queue& operator=(Queue&& other) noexcept(std::is_nothrow_move_assignable<Storage>::value); // Move assignment, leaves other empty
+            void enqueue(const T& value); // Add a copy of value at the rear of the queue
+            void enqueue(T&& value); // Move value to the rear of the queue
+            template<typename... Args>
+            T& emplace(Args&&... args); // Construct an element in place in the rear slot of the queue
             T dequeue(); // Returns the removed element from the front of the queue
-            T front(); // Returns the front element of the queue
-            T rear(); // Returns the rear element of the queue
-            int size(); // Returns the number of elements in the queue
-            bool isEmpty(); // Returns true if queue is empty, false otherwise
+            T& front(); // Returns a reference to the front element of the queue
+            const T& front() const; // Returns a reference to the front element of the queue
+            T& rear(); // Returns a reference to the rear element of the queue
+            const T& rear() const; // Returns a reference to the rear element of the queue
+            int size() const; // Returns the number of elements in the queue
+            bool isEmpty() const; // Returns true if queue is empty, false otherwise
+            std::pair<ArrayView<const T>, ArrayView<const T>> views() const; // Returns the elements front to rear as two contiguous views
             void print(); // Outputs all the elements in the queue
     };
-}
\ No newline at end of file
+}
+
+#include "Queue.tpp"
+
+#ifdef DSA_EXPLICIT_INSTANTIATION
+#include <string>
+
+// Instantiated once in src/Queue.cpp instead of in every translation unit
+extern template class dsa::Queue<int>;
+extern template class dsa::Queue<float>;
+extern template class dsa::Queue<double>;
+extern template class dsa::Queue<char>;
+extern template class dsa::Queue<std::string>;
+#endif
\ No newline at end of file
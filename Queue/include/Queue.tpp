@@ -0,0 +1,232 @@
+#pragma once
+// Template definitions for Queue.h (included at the end of Queue.h)
+#include <iostream>
+#include <new>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+
+namespace dsa {
+    template<typename T, typename Storage>
+    Queue<T, Storage>::Queue() : frontIndex(0), rearIndex(-1), count(0), capacity(0) {};
+
+    template<typename T, typename Storage>
+    Queue<T, Storage>::Queue(Queue&& other) noexcept(std::is_nothrow_move_constructible<Storage>::value)
+        : queue(std::move(other.queue)), frontIndex(other.frontIndex), rearIndex(other.rearIndex),
+          count(other.count), capacity(other.capacity) {
+        // other's slots were taken along with its array, so its indices must start over too
+        other.resetIndices();
+    }
+
+    template<typename T, typename Storage>
+    Queue<T, Storage>& Queue<T, Storage>::operator=(Queue&& other) noexcept(std::is_nothrow_move_assignable<Storage>::value) {
+        if (this == &other) {
+            return *this;
+        }
+        queue = std::move(other.queue);
+        frontIndex = other.frontIndex;
+        rearIndex = other.rearIndex;
+        count = other.count;
+        capacity = other.capacity;
+        other.resetIndices();
+        return *this;
+    }
+
+    template<typename T, typename Storage>
+    void Queue<T, Storage>::resetIndices() {
+        // same state as a default-constructed queue: the next enqueue grows the (empty) array to 8 slots
+        frontIndex = 0;
+        rearIndex = -1;
+        count = 0;
+        capacity = 0;
+    }
+
+    template<typename T, typename Storage>
+    int Queue<T, Storage>::wrap(int index) const {
+        // capacity is a power of two, so masking is the same as index % capacity
+        return index & (capacity - 1);
+    }
+
+    template<typename T, typename Storage>
+    void Queue<T, Storage>::grow() {
+        /*
+        Algorithm to grow the ring buffer:
+            1. double the capacity (start at 8 slots for an empty queue)
+            2. reserve the new capacity once, then push default slots into the
+               array until it holds the new capacity
+            3. if the elements wrapped around (front > 0), move the wrapped
+               prefix [0, frontIndex) to the first new slots [oldCapacity, ...)
+               so the elements are contiguous again from frontIndex
+            4. recompute rearIndex from frontIndex and count
+        */
+       int oldCapacity = capacity;
+       capacity = (oldCapacity == 0) ? 8 : oldCapacity * 2;
+       queue.reserve(capacity);
+       for (int i = oldCapacity; i < capacity; i++) {
+        queue.emplaceBack();
+       }
+
+       if (count > 0 && frontIndex > 0) {
+        for (int i = 0; i < frontIndex; i++) {
+            queue[oldCapacity + i] = std::move(queue[i]);
+            queue[i] = T();
+        }
+       }
+       rearIndex = wrap(frontIndex + count - 1);
+    }
+
+    template<typename T, typename Storage>
+    template<typename... Args>
+    T& Queue<T, Storage>::emplace(Args&&... args) {
+        /*
+        Algorithm to enqueue an element:
+            1. if the ring buffer is full (count == capacity):
+                a. construct the element first, since args may refer to an
+                   element that grow() is about to move
+                b. call grow()
+            2. advance rearIndex by one slot, wrapping around the end
+            3. the slot holds a default (reset) element: destroy it and construct
+               the new element directly in its place (from args, or by moving the
+               element built in 1a), then increment count
+            -> if that constructor throws, the slot gets a default element back, so
+               the ring stays fully constructed
+        */
+       if (count == capacity) {
+        T value(std::forward<Args>(args)...);
+        grow();
+        rearIndex = wrap(rearIndex + 1);
+        constructInSlot(rearIndex, std::move(value));
+       } else {
+        rearIndex = wrap(rearIndex + 1);
+        constructInSlot(rearIndex, std::forward<Args>(args)...);
+       }
+       count++;
+       return queue[rearIndex];
+    }
+
+    template<typename T, typename Storage>
+    template<typename... Args>
+    void Queue<T, Storage>::constructInSlot(int slot, Args&&... args) {
+        T* element = &queue[slot];
+        element->~T();
+        try {
+            new (element) T(std::forward<Args>(args)...);
+        } catch (...) {
+            new (element) T();
+            rearIndex = wrap(rearIndex - 1);
+            throw;
+        }
+    }
+
+    template<typename T, typename Storage>
+    void Queue<T, Storage>::enqueue(const T& value) {
+       emplace(value);
+    }
+
+    template<typename T, typename Storage>
+    void Queue<T, Storage>::enqueue(T&& value) {
+       emplace(std::move(value));
+    }
+
+    template<typename T, typename Storage>
+    T Queue<T, Storage>::dequeue() {
+        /*
+        Algorithm to dequeue an element:
+            1. check if the queue is empty:
+                -> if empty, throw an exception
+            2. move the element at frontIndex out and reset its slot
+            3. advance frontIndex by one slot, wrapping around the end
+            4. decrement count and return the stored variable
+        */
+        if (isEmpty()) {
+            throw std::out_of_range("Queue underflow. Cannot dequeue.");
+        }
+        T frontElement = std::move(queue[frontIndex]);
+        queue[frontIndex] = T(); // release the slot
+        frontIndex = wrap(frontIndex + 1);
+        count--;
+        return frontElement;
+    }
+
+    template<typename T, typename Storage>
+    T& Queue<T, Storage>::front() {
+        /*
+        Algorithm to return the front element:
+            1. check if the queue is empty:
+                -> if empty, throw an exception
+            2. return a reference to queue[frontIndex]
+        */
+       if (isEmpty()) {
+           throw std::out_of_range("Queue is empty. No front element.");
+       }
+       return queue[frontIndex];
+    }
+
+    template<typename T, typename Storage>
+    const T& Queue<T, Storage>::front() const {
+       if (isEmpty()) {
+            throw std::out_of_range("Queue is empty. No front element.");
+       }
+       return queue[frontIndex];
+    }
+
+    template<typename T, typename Storage>
+    T& Queue<T, Storage>::rear() {
+        /*
+        Algorithm to return the rear element:
+            1. check if the queue is empty:
+                -> if empty, throw an exception
+            2. return a reference to queue[rearIndex]
+        */
+       if (isEmpty()) {
+            throw std::out_of_range("Queue is empty. No rear element.");
+       }
+       return queue[rearIndex];
+    }
+
+    template<typename T, typename Storage>
+    const T& Queue<T, Storage>::rear() const {
+       if (isEmpty()) {
+            throw std::out_of_range("Queue is empty. No rear element.");
+       }
+       return queue[rearIndex];
+    }
+
+    template<typename T, typename Storage>
+    int Queue<T, Storage>::size() const {
+        /*
+        Algorithm to return the size of the queue:
+            1. return count (the array always holds capacity slots)
+        */
+       return count;
+    }
+
+    template<typename T, typename Storage>
+    bool Queue<T, Storage>::isEmpty() const { return count == 0; };
+
+    template<typename T, typename Storage>
+    std::pair<ArrayView<const T>, ArrayView<const T>> Queue<T, Storage>::views() const {
+        /*
+        Algorithm to view the queue without copying:
+            1. the elements run from frontIndex towards the end of the ring buffer
+            2. if they wrap around, the rest continues from slot 0
+            -> first view: [frontIndex, min(frontIndex + count, capacity))
+            -> second view: [0, remaining), empty unless the elements wrap
+        */
+        if (count == 0) {
+            return {ArrayView<const T>(), ArrayView<const T>()};
+        }
+        int firstCount = (frontIndex + count <= capacity) ? count : capacity - frontIndex;
+        ArrayView<const T> slots = queue.view();
+        return {slots.subview(frontIndex, firstCount), slots.subview(0, count - firstCount)};
+    }
+
+    template<typename T, typename Storage>
+    void Queue<T, Storage>::print() {
+        std::cout << "Queue [size: " << size() << "]: ";
+        for (int i = 0; i < count; i++) {
+            std::cout << queue[wrap(frontIndex + i)] << " ";
+        }
+        std::cout << std::endl;
+    }
+}
\ No newline at end of file
@@ -1,5 +1,6 @@
 #include "Queue.h"
 #include <iostream>
+#include <stdexcept>
 #include <string>
 
 using namespace dsa;
@@ -77,10 +78,85 @@ void testCharQueue() {
     cout << endl;
 }
 
+void testWrapAround() {
+    cout << "=== Testing Queue wrap-around and growth ===" << endl;
+    Queue<int> q;
+
+    // Fill past the initial ring capacity while draining from the front,
+    // so the rear index wraps around before the buffer has to grow
+    for (int i = 1; i <= 6; i++) {
+        q.enqueue(i);
+    }
+    cout << "Dequeue: " << q.dequeue() << ", Dequeue: " << q.dequeue() << endl;
+    for (int i = 7; i <= 20; i++) {
+        q.enqueue(i);
+    }
+    q.print();
+    cout << "Size: " << q.size() << ", Front: " << q.front() << ", Rear: " << q.rear() << endl;
+
+    // Wrap the ring without growing it and read it back as two views
+    Queue<int> ring;
+    for (int i = 1; i <= 6; i++) {
+        ring.enqueue(i);
+    }
+    ring.dequeue();
+    ring.dequeue();
+    for (int i = 7; i <= 10; i++) {
+        ring.enqueue(i);
+    }
+    auto parts = ring.views();
+    cout << "Views:";
+    for (int value : parts.first) {
+        cout << " " << value;
+    }
+    cout << " |";
+    for (int value : parts.second) {
+        cout << " " << value;
+    }
+    cout << endl;
+
+    cout << endl;
+}
+
+// A moved-from queue must be empty and accept new elements
+void testMovedFromQueue() {
+    cout << "=== Testing moved-from Queue ===" << endl;
+    Queue<int> source;
+    for (int i = 1; i <= 5; i++) {
+        source.enqueue(i);
+    }
+    Queue<int> target(std::move(source));
+    cout << "Moved-to size: " << target.size() << ", Front: " << target.front() << endl;
+    cout << "Moved-from size: " << source.size() << ", Is empty: " << (source.isEmpty() ? "Yes" : "No") << endl;
+    if (!source.isEmpty() || source.size() != 0) {
+        throw runtime_error("moved-from Queue is not empty");
+    }
+    for (int i = 10; i <= 12; i++) {
+        source.enqueue(i);
+    }
+    cout << "Reused moved-from queue: ";
+    source.print();
+
+    Queue<string> words;
+    words.enqueue("first");
+    words.enqueue("second");
+    Queue<string> other;
+    other = std::move(words);
+    words.enqueue("again");
+    cout << "Move-assigned front: " << other.front() << ", moved-from now holds: " << words.front()
+         << " (size " << words.size() << ")" << endl;
+    if (words.size() != 1 || other.size() != 2) {
+        throw runtime_error("moved-from Queue is in the wrong state");
+    }
+    cout << endl;
+}
+
 int main() {
     testIntQueue();
     testStringQueue();
     testCharQueue();
+    testWrapAround();
+    testMovedFromQueue();
 
     cout << "All tests completed successfully!" << endl;
     return 0;
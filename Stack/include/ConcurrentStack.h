@@ -0,0 +1,120 @@
+#pragma once
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <utility>
+#include <vector>
+
+namespace dsa {
+    namespace detail {
+        // Test hook, defined by test code only: may construct stacks with private test options
+        struct ConcurrentStackTesting;
+    }
+
+    /*
+    Lock-free stack (Treiber stack) for many threads pushing and popping at once.
+    push and tryPop update the top with a compare-and-swap loop instead of taking a lock.
+
+    ABA: the head word packs the top node pointer with a 16-bit tag that every
+    successful push/pop increments, so a CAS fails if the top was popped and pushed
+    back in between, even if the same address came back. The tag lives in the upper
+    16 bits of a 64-bit pointer (user-space addresses fit in 48 bits on x86-64 and
+    AArch64), which keeps the head a single lock-free word.
+
+    Reclamation: a popped node may still be read by another thread that loaded it as
+    the top a moment earlier. Before dereferencing the top, a thread publishes it in a
+    hazard pointer; a popped node is retired and only deleted once no hazard pointer
+    refers to it.
+
+    Elimination: a push and a pop that both lose the race for the head can cancel each
+    other out instead of retrying it. The losing push parks its node in a random slot of
+    a small elimination array and waits briefly; a losing pop checks a random slot and
+    takes a parked node directly. Neither touches the head, so under heavy contention
+    more threads mean more such pairs instead of more failed CASes on one word.
+
+    Nodes come from operator new (the repo's allocators are single-threaded).
+    */
+    template<typename T>
+    class ConcurrentStack {
+        private:
+            struct Node {
+                T value;
+                Node* next;
+                template<typename Value>
+                explicit Node(Value&& value) : value(std::forward<Value>(value)), next(nullptr) {}
+            };
+
+            // One per concurrent operation; records are reused and only freed by the destructor
+            struct HazardRecord {
+                std::atomic<Node*> hazard; // node the owning thread is about to dereference
+                std::atomic<bool> active; // true while an operation owns this record
+                HazardRecord* next; // next record, fixed before the record is published
+                std::vector<Node*> retired; // popped nodes waiting for deletion (not chained through Node::next,
+                                            // which a thread holding a stale top may still be reading)
+
+                HazardRecord() : hazard(nullptr), active(true), next(nullptr) {}
+            };
+
+            // Elimination slot: EMPTY, a parked node offered by a push, or TAKEN by a pop
+            struct alignas(64) EliminationSlot {
+                std::atomic<std::uintptr_t> state; // one slot per cache line, so slots do not share lines
+                EliminationSlot() : state(0) {}
+            };
+
+            static constexpr int TAG_SHIFT = 48; // the tag occupies bits 48..63 of the head word
+            static constexpr std::uintptr_t POINTER_MASK = (std::uintptr_t(1) << TAG_SHIFT) - 1;
+            static constexpr int RETIRE_THRESHOLD = 64; // retired nodes per record before a scan (plus 2 per record)
+            static constexpr std::uintptr_t EMPTY = 0; // slot state: no offer
+            static constexpr std::uintptr_t TAKEN = 1; // slot state: a pop took the offer (nodes are never at address 1)
+            static constexpr int MAX_ELIMINATION_SLOTS = 32; // upper bound for the elimination array
+            static constexpr int ELIMINATION_SPINS = 128; // polls a parked push waits for a pop
+
+            std::atomic<std::uintptr_t> head; // top node pointer and tag, packed
+            std::atomic<HazardRecord*> records; // all hazard records, newest first
+            std::atomic<int> recordCount; // number of hazard records
+            std::unique_ptr<EliminationSlot[]> slots; // elimination array
+            int slotCount; // half the hardware threads, between 1 and MAX_ELIMINATION_SLOTS
+            const bool eliminateFirst; // every push and pop tries the elimination array before the head (testing)
+
+            static std::uintptr_t pack(Node* node, std::uintptr_t tag); // Packs a node pointer and a tag into a head word
+            static Node* nodeOf(std::uintptr_t word); // Node pointer of a head word
+            static std::uintptr_t tagOf(std::uintptr_t word); // Tag of a head word
+
+            HazardRecord* acquireRecord(); // Claims an idle hazard record or publishes a new one
+            void releaseRecord(HazardRecord* record); // Hands the record back for other operations
+            void retire(HazardRecord* record, Node* node); // Queues a popped node, scanning when the queue is long
+            void scan(HazardRecord* record); // Deletes the record's retired nodes no hazard pointer refers to
+            void pushNode(Node* node); // CAS loop linking node as the new top, trying elimination after each failed CAS
+            int randomSlot() const; // Picks an elimination slot with a per-thread generator
+            bool tryEliminatePush(Node* node); // Parks node for a pop; true if a pop took it
+            Node* tryEliminatePop(); // Takes a parked node, or returns nullptr
+            static void takeEliminated(Node* node, T& value); // Moves a node's value out of an eliminated push and frees it
+
+            explicit ConcurrentStack(bool eliminateFirst); // Constructor for tests; true sends every push and pop through the elimination array first
+            friend struct detail::ConcurrentStackTesting;
+
+        public:
+            ConcurrentStack(); // Constructor
+            ConcurrentStack(const ConcurrentStack&) = delete;
+            ConcurrentStack& operator=(const ConcurrentStack&) = delete;
+            ~ConcurrentStack(); // Destructor, must not race with other operations
+
+            void push(const T& value); // Adds a copy of value at the top of the stack, lock-free
+            void push(T&& value); // Moves value to the top of the stack, lock-free
+            bool tryPop(T& value); // Moves the top element into value and returns true, or returns false if the stack is empty; never throws for an empty stack
+            bool isEmpty() const; // True if the stack was empty at the moment of the call
+    };
+}
+
+#include "ConcurrentStack.tpp"
+
+#ifdef DSA_EXPLICIT_INSTANTIATION
+#include <string>
+
+// Instantiated once in src/ConcurrentStack.cpp instead of in every translation unit
+extern template class dsa::ConcurrentStack<int>;
+extern template class dsa::ConcurrentStack<float>;
+extern template class dsa::ConcurrentStack<double>;
+extern template class dsa::ConcurrentStack<char>;
+extern template class dsa::ConcurrentStack<std::string>;
+#endif
\ No newline at end of file
@@ -0,0 +1,302 @@
+#pragma once
+// Template definitions for ConcurrentStack.h (included at the end of ConcurrentStack.h)
+#include <algorithm> // For std::sort, std::binary_search, std::clamp
+#include <functional> // For std::hash
+#include <random>
+#include <stdexcept>
+#include <thread>
+#include <utility>
+
+namespace dsa {
+    template<typename T>
+    ConcurrentStack<T>::ConcurrentStack() : ConcurrentStack(false) {}
+
+    template<typename T>
+    ConcurrentStack<T>::ConcurrentStack(bool eliminateFirst)
+        : head(0), records(nullptr), recordCount(0), eliminateFirst(eliminateFirst) {
+        static_assert(sizeof(std::uintptr_t) == 8, "ConcurrentStack packs its ABA tag into the upper bits of 64-bit pointers");
+        // about one slot per push/pop pair that can run at the same time
+        slotCount = std::clamp(static_cast<int>(std::thread::hardware_concurrency() / 2), 1, MAX_ELIMINATION_SLOTS);
+        slots.reset(new EliminationSlot[slotCount]);
+    }
+
+    template<typename T>
+    ConcurrentStack<T>::~ConcurrentStack() {
+        // no other thread is using the stack any more: free the nodes, the retired nodes and the records
+        Node* node = nodeOf(head.load(std::memory_order_acquire));
+        while (node != nullptr) {
+            Node* next = node->next;
+            delete node;
+            node = next;
+        }
+        HazardRecord* record = records.load(std::memory_order_acquire);
+        while (record != nullptr) {
+            for (Node* retired : record->retired) {
+                delete retired;
+            }
+            HazardRecord* next = record->next;
+            delete record;
+            record = next;
+        }
+    }
+
+    template<typename T>
+    std::uintptr_t ConcurrentStack<T>::pack(Node* node, std::uintptr_t tag) {
+        return reinterpret_cast<std::uintptr_t>(node) | (tag << TAG_SHIFT);
+    }
+
+    template<typename T>
+    typename ConcurrentStack<T>::Node* ConcurrentStack<T>::nodeOf(std::uintptr_t word) {
+        return reinterpret_cast<Node*>(word & POINTER_MASK);
+    }
+
+    template<typename T>
+    std::uintptr_t ConcurrentStack<T>::tagOf(std::uintptr_t word) {
+        return word >> TAG_SHIFT;
+    }
+
+    template<typename T>
+    typename ConcurrentStack<T>::HazardRecord* ConcurrentStack<T>::acquireRecord() {
+        /*
+        Algorithm to acquire a hazard record:
+            -> Walk the record list and claim the first idle record by CAS-ing its active flag
+               from false to true (acquire, so its retired list is visible)
+            -> If every record is busy, create one (already active) and push it on the record
+               list with a CAS loop; records are never unlinked, so this list has no ABA problem
+            -> Time Complexity: O(number of records), at most one allocation per concurrent operation ever
+        */
+        for (HazardRecord* record = records.load(std::memory_order_acquire); record != nullptr; record = record->next) {
+            bool idle = false;
+            if (!record->active.load(std::memory_order_relaxed) &&
+                record->active.compare_exchange_strong(idle, true, std::memory_order_acquire, std::memory_order_relaxed)) {
+                return record;
+            }
+        }
+        HazardRecord* record = new HazardRecord();
+        HazardRecord* first = records.load(std::memory_order_relaxed);
+        do {
+            record->next = first;
+        } while (!records.compare_exchange_weak(first, record, std::memory_order_release, std::memory_order_relaxed));
+        recordCount.fetch_add(1, std::memory_order_relaxed);
+        return record;
+    }
+
+    template<typename T>
+    void ConcurrentStack<T>::releaseRecord(HazardRecord* record) {
+        record->hazard.store(nullptr, std::memory_order_release);
+        record->active.store(false, std::memory_order_release);
+    }
+
+    template<typename T>
+    void ConcurrentStack<T>::retire(HazardRecord* record, Node* node) {
+        // the popped node is unreachable from head but may still be read through a hazard pointer
+        record->retired.push_back(node);
+        if (static_cast<int>(record->retired.size()) >= RETIRE_THRESHOLD + 2 * recordCount.load(std::memory_order_relaxed)) {
+            scan(record);
+        }
+    }
+
+    template<typename T>
+    void ConcurrentStack<T>::scan(HazardRecord* record) {
+        /*
+        Algorithm to reclaim retired nodes:
+            -> Collect every published hazard pointer and sort them
+            -> Delete each retired node that no hazard pointer refers to; keep the others
+               on the retired list for a later scan
+            -> The threshold grows with the number of records, so each scan frees at least
+               half of what it looks at and reclamation costs O(1) amortized per pop
+            -> Time Complexity: O(R log H) for R retired nodes and H hazard pointers
+        */
+        std::vector<Node*> hazards;
+        for (HazardRecord* other = records.load(std::memory_order_acquire); other != nullptr; other = other->next) {
+            Node* hazard = other->hazard.load(std::memory_order_seq_cst);
+            if (hazard != nullptr) {
+                hazards.push_back(hazard);
+            }
+        }
+        std::sort(hazards.begin(), hazards.end());
+
+        int kept = 0;
+        for (Node* retired : record->retired) {
+            if (std::binary_search(hazards.begin(), hazards.end(), retired)) {
+                record->retired[kept++] = retired;
+            } else {
+                delete retired;
+            }
+        }
+        record->retired.resize(kept);
+    }
+
+    template<typename T>
+    int ConcurrentStack<T>::randomSlot() const {
+        thread_local std::minstd_rand generator(static_cast<unsigned int>(std::hash<std::thread::id>()(std::this_thread::get_id())));
+        return static_cast<int>(generator() % static_cast<unsigned int>(slotCount));
+    }
+
+    template<typename T>
+    bool ConcurrentStack<T>::tryEliminatePush(Node* node) {
+        /*
+        Algorithm to eliminate a push:
+            -> Offer the node by CAS-ing a random slot from EMPTY to the node's address
+               (release, so a pop that takes it sees the value); give up if the slot is busy
+            -> Poll the slot a bounded number of times; once a pop has marked it TAKEN, the
+               node belongs to that pop: reset the slot to EMPTY and report success
+            -> On timeout withdraw the offer by CAS-ing the slot from the node back to EMPTY;
+               if that fails, a pop took the node at the last moment, which is also success
+            -> Only the parked push resets a TAKEN slot, so no other push can reuse the slot
+               (and no address can be recycled into it) until this push has seen the outcome
+        */
+        EliminationSlot& slot = slots[randomSlot()];
+        std::uintptr_t offer = reinterpret_cast<std::uintptr_t>(node);
+        std::uintptr_t expected = EMPTY;
+        if (!slot.state.compare_exchange_strong(expected, offer, std::memory_order_release, std::memory_order_relaxed)) {
+            return false;
+        }
+        for (int i = 0; i < ELIMINATION_SPINS; i++) {
+            if (slot.state.load(std::memory_order_acquire) == TAKEN) {
+                slot.state.store(EMPTY, std::memory_order_release);
+                return true;
+            }
+        }
+        expected = offer;
+        if (slot.state.compare_exchange_strong(expected, EMPTY, std::memory_order_acquire)) {
+            return false;
+        }
+        slot.state.store(EMPTY, std::memory_order_release);
+        return true;
+    }
+
+    template<typename T>
+    typename ConcurrentStack<T>::Node* ConcurrentStack<T>::tryEliminatePop() {
+        /*
+        Algorithm to eliminate a pop:
+            -> Look at a random slot; if it holds an offered node, CAS it to TAKEN (acquire)
+            -> Winning the CAS hands the node to this pop: it was never on the stack, so no other
+               thread can reach it and it can be deleted right away without hazard pointers
+            -> Never waits: an empty or contended slot just sends the pop back to the head
+        */
+        EliminationSlot& slot = slots[randomSlot()];
+        std::uintptr_t offer = slot.state.load(std::memory_order_relaxed);
+        if (offer == EMPTY || offer == TAKEN) {
+            return nullptr;
+        }
+        if (slot.state.compare_exchange_strong(offer, TAKEN, std::memory_order_acquire, std::memory_order_relaxed)) {
+            return reinterpret_cast<Node*>(offer);
+        }
+        return nullptr;
+    }
+
+    template<typename T>
+    void ConcurrentStack<T>::takeEliminated(Node* node, T& value) {
+        // the node never reached the stack, so no hazard pointer can refer to it
+        value = std::move(node->value);
+        delete node;
+    }
+
+    template<typename T>
+    void ConcurrentStack<T>::pushNode(Node* node) {
+        /*
+        Algorithm to push a node:
+            -> Read the head word, point the node at the current top
+            -> CAS the head from that word to (node, tag + 1); release ordering publishes the
+               node's contents to the thread that pops it
+            -> A failed CAS means contention: try to hand the node straight to a pop through the
+               elimination array, and only if that fails re-read the head and retry
+            -> Lock-free: a CAS only fails because another push or pop succeeded
+            -> With eliminateFirst the node is offered to a pop before every CAS attempt
+        */
+        if (reinterpret_cast<std::uintptr_t>(node) & ~POINTER_MASK) {
+            delete node;
+            throw std::runtime_error("Node address does not fit below the ABA tag");
+        }
+        std::uintptr_t top = head.load(std::memory_order_relaxed);
+        while (true) {
+            if (eliminateFirst && tryEliminatePush(node)) {
+                return;
+            }
+            node->next = nodeOf(top);
+            if (head.compare_exchange_strong(top, pack(node, tagOf(top) + 1),
+                                             std::memory_order_release, std::memory_order_relaxed)) {
+                return;
+            }
+            if (tryEliminatePush(node)) {
+                return;
+            }
+            top = head.load(std::memory_order_relaxed);
+        }
+    }
+
+    template<typename T>
+    void ConcurrentStack<T>::push(const T& value) {
+        pushNode(new Node(value));
+    }
+
+    template<typename T>
+    void ConcurrentStack<T>::push(T&& value) {
+        pushNode(new Node(std::move(value)));
+    }
+
+    template<typename T>
+    bool ConcurrentStack<T>::tryPop(T& value) {
+        /*
+        Algorithm to pop the top element:
+            -> Claim a hazard record
+            -> Read the head word; if it holds no node the stack is empty: return false
+            -> Publish the top node as this thread's hazard, then re-read the head: if it
+               changed, the node may already be retired, so start over with the new word
+            -> The node is now safe to read: CAS the head from the word to (node->next, tag + 1);
+               the tag makes the CAS fail if the node was popped and pushed again meanwhile
+            -> If the CAS fails, try to take a node parked by a push in the elimination array
+               before retrying
+            -> After winning the CAS, clear the hazard, move the value out and retire the node
+            -> With eliminateFirst a parked node is looked for before every attempt, even on an empty stack
+            -> Time Complexity: O(1) per attempt, lock-free
+        */
+        HazardRecord* record = acquireRecord();
+        std::uintptr_t top = head.load(std::memory_order_acquire);
+        Node* node;
+        while (true) {
+            if (eliminateFirst) {
+                Node* eliminated = tryEliminatePop();
+                if (eliminated != nullptr) {
+                    releaseRecord(record);
+                    takeEliminated(eliminated, value);
+                    return true;
+                }
+            }
+            node = nodeOf(top);
+            if (node == nullptr) {
+                releaseRecord(record);
+                return false;
+            }
+            record->hazard.store(node, std::memory_order_seq_cst);
+            std::uintptr_t current = head.load(std::memory_order_seq_cst);
+            if (current != top) {
+                top = current;
+                continue;
+            }
+            if (head.compare_exchange_strong(top, pack(node->next, tagOf(top) + 1),
+                                             std::memory_order_acq_rel, std::memory_order_acquire)) {
+                break;
+            }
+            // lost the race for the head: take a value from a parked push instead, if there is one
+            Node* eliminated = tryEliminatePop();
+            if (eliminated != nullptr) {
+                releaseRecord(record);
+                takeEliminated(eliminated, value);
+                return true;
+            }
+            top = head.load(std::memory_order_acquire);
+        }
+        record->hazard.store(nullptr, std::memory_order_release);
+        value = std::move(node->value);
+        retire(record, node);
+        releaseRecord(record);
+        return true;
+    }
+
+    template<typename T>
+    bool ConcurrentStack<T>::isEmpty() const {
+        return nodeOf(head.load(std::memory_order_acquire)) == nullptr;
+    }
+}
\ No newline at end of file
@@ -1,20 +1,41 @@
 #pragma once
 #include "../../Array/include/Array.h"
+#include "../../Array/include/SmallArray.h"
 
 namespace dsa {
-    template<typename T>
+    // Storage is the backing array: Array<T> by default, or e.g. SmallArray<T, 16>
+    // to keep small stacks off the heap
+    template<typename T, typename Storage = Array<T>>
     class Stack {
         private:
-            Array<T> stack;
-            int topIndex; // Points to the top element in the stack
+            Storage stack; // the elements, bottom to top; the top is the last one, so a moved-from stack is simply empty
 
         public:
             Stack(); // Constructor
-            void push(T value); // Add element at the top of the stack
+            void push(const T& value); // Add a copy of value at the top of the stack
+            void push(T&& value); // Move value to the top of the stack
+            template<typename... Args>
+            T& emplace(Args&&... args); // Construct an element in place at the top of the stack
             T pop(); // Returns the removed element
-            T top(); // Returns the top element of the stack
-            int size(); // Returns the number of elements in the stack
-            bool isEmpty(); // Returns true if the stack is empty, false otherwise
+            T& top(); // Returns a reference to the top element of the stack
+            const T& top() const; // Returns a reference to the top element of the stack
+            int size() const; // Returns the number of elements in the stack
+            bool isEmpty() const; // Returns true if the stack is empty, false otherwise
+            ArrayView<T> view(); // Returns a non-owning view of the elements, bottom to top
+            ArrayView<const T> view() const; // Returns a non-owning read-only view of the elements, bottom to top
             void print(); // Outputs all the elements in the stack
     };
-}
\ No newline at end of file
+}
+
+#include "Stack.tpp"
+
+#ifdef DSA_EXPLICIT_INSTANTIATION
+#include <string>
+
+// Instantiated once in src/Stack.cpp instead of in every translation unit
+extern template class dsa::Stack<int>;
+extern template class dsa::Stack<float>;
+extern template class dsa::Stack<double>;
+extern template class dsa::Stack<char>;
+extern template class dsa::Stack<std::string>;
+#endif
\ No newline at end of file
@@ -0,0 +1,87 @@
+#pragma once
+// Template definitions for Stack.h (included at the end of Stack.h)
+#include <iostream>
+#include <stdexcept>
+#include <utility>
+
+namespace dsa {
+    template<typename T, typename Storage>
+    Stack<T, Storage>::Stack() {
+        // stack is default constructed
+    }
+
+    template<typename T, typename Storage>
+    void Stack<T, Storage>::push(const T& value) {
+        /*
+        Algorithm to push element to a stack:
+            -> call stack.push(), the new element is the top (index stack.getSize() - 1)
+        */
+       stack.push(value);
+    }
+
+    template<typename T, typename Storage>
+    void Stack<T, Storage>::push(T&& value) {
+        // same as push(const T&), but the value is moved into the array
+       stack.push(std::move(value));
+    }
+
+    template<typename T, typename Storage>
+    template<typename... Args>
+    T& Stack<T, Storage>::emplace(Args&&... args) {
+        // constructs the new top element directly inside the array
+       return stack.emplaceBack(std::forward<Args>(args)...);
+    }
+
+    template<typename T, typename Storage>
+    T Stack<T, Storage>::pop() {
+        /*
+        Algorithm to pop element from stack:
+        -> check if stack is empty
+            -> if empty, throw an exception    
+        -> return the result of stack.pop()
+            
+        */
+       if (isEmpty()) {
+        std::cout << "Stack Underflow: Cannot pop from an empty stack." << std::endl;
+        throw std::out_of_range("The stack is empty");
+       }
+       return stack.pop();
+    }
+
+    template<typename T, typename Storage>
+    T& Stack<T, Storage>::top() { 
+        if (isEmpty()) {
+            throw std::out_of_range("The stack is empty");
+        }
+        return stack[stack.getSize() - 1]; 
+    }
+
+    template<typename T, typename Storage>
+    const T& Stack<T, Storage>::top() const { 
+        if (isEmpty()) {
+            throw std::out_of_range("The stack is empty");
+        }
+        return stack[stack.getSize() - 1]; 
+    }
+
+    template<typename T, typename Storage>
+    int Stack<T, Storage>::size() const { return stack.getSize(); };
+
+    template<typename T, typename Storage>
+    bool Stack<T, Storage>::isEmpty() const { return stack.isEmpty(); };
+
+    template<typename T, typename Storage>
+    ArrayView<T> Stack<T, Storage>::view() { return stack.view(); }
+
+    template<typename T, typename Storage>
+    ArrayView<const T> Stack<T, Storage>::view() const { return stack.view(); }
+
+    template<typename T, typename Storage>
+    void Stack<T, Storage>::print() {
+        std::cout << "Stack [size: " << size() << "]: ";
+        for (int i = size() - 1; i >= 0; i--) {
+            std::cout << stack.get(i) << " ";
+        }
+        std::cout << std::endl;
+    }
+}
\ No newline at end of file
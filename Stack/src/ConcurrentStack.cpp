@@ -0,0 +1,11 @@
+// Precompiled instantiations for the DSA_EXPLICIT_INSTANTIATION build.
+// The header-only build does not compile this file.
+#include "ConcurrentStack.h"
+#include <string>
+
+// Explicit template instantiation for common types
+template class dsa::ConcurrentStack<int>;
+template class dsa::ConcurrentStack<float>;
+template class dsa::ConcurrentStack<double>;
+template class dsa::ConcurrentStack<char>;
+template class dsa::ConcurrentStack<std::string>;
\ No newline at end of file
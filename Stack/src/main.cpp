@@ -1,7 +1,24 @@
 #include "Stack.h"
+#include "ConcurrentStack.h"
+#include <atomic>
 #include <iostream>
 #include <stdexcept>
 #include <string>
+#include <thread>
+#include <vector>
+
+namespace dsa {
+    namespace detail {
+        // Test hook (see ConcurrentStack.h): stacks that try the elimination array before the
+        // head on every push and pop, so the handoff runs without heavy contention
+        struct ConcurrentStackTesting {
+            template<typename T>
+            static ConcurrentStack<T> eliminatingStack() {
+                return ConcurrentStack<T>(true);
+            }
+        };
+    }
+}
 
 using namespace dsa;
 using namespace std;
@@ -39,6 +56,11 @@ void testIntStack() {
     cout << "   Size: " << stack.size() << endl;
     cout << "   Top: " << stack.top() << endl;
     stack.print();
+    cout << "   Bottom to top via view():";
+    for (int value : stack.view()) {
+        cout << " " << value;
+    }
+    cout << endl;
 
     // Test pop operations
     cout << "\n3. Popping elements:" << endl;
@@ -169,12 +191,111 @@ void testEdgeCases() {
     }
 }
 
+// A moved-from stack must be empty and usable again
+void testMovedFromStack() {
+    cout << "\n=== Testing moved-from Stack<string> ===" << endl;
+    Stack<string> source;
+    source.push("alpha");
+    source.push("beta");
+    Stack<string> target(std::move(source));
+    cout << "1. Moved-to top: " << target.top() << ", size " << target.size() << endl;
+    cout << "2. Moved-from size: " << source.size() << ", is empty: " << (source.isEmpty() ? "Yes" : "No") << endl;
+    if (!source.isEmpty() || source.size() != 0) {
+        throw runtime_error("moved-from Stack is not empty");
+    }
+    try {
+        source.top();
+        throw runtime_error("top() on a moved-from Stack did not throw");
+    } catch (const out_of_range& e) {
+        cout << "   Top exception: " << e.what() << endl;
+    }
+    source.push("gamma");
+    cout << "3. Reused moved-from stack, top: " << source.top() << ", size " << source.size() << endl;
+
+    Stack<string, SmallArray<string, 4>> small;
+    small.push("inline");
+    Stack<string, SmallArray<string, 4>> smallTarget;
+    smallTarget = std::move(small);
+    cout << "4. SmallArray-backed: moved-to top " << smallTarget.top()
+         << ", moved-from is empty: " << (small.isEmpty() ? "Yes" : "No") << endl;
+    if (!small.isEmpty() || source.size() != 1) {
+        throw runtime_error("moved-from Stack is in the wrong state");
+    }
+}
+
+// Producers push unique values while consumers pop them; throws unless every value
+// came out exactly once (no value lost or duplicated)
+void checkContendedPushPop(ConcurrentStack<int>& stack, int threads, int perThread) {
+    const int total = threads * perThread;
+    vector<atomic<int>> seen(total);
+    for (atomic<int>& count : seen) {
+        count.store(0);
+    }
+    atomic<long> sum(0);
+    atomic<int> popped(0);
+    vector<thread> workers;
+    for (int t = 0; t < threads; t++) {
+        workers.emplace_back([&stack, t, perThread]() {
+            for (int i = 0; i < perThread; i++) {
+                stack.push(t * perThread + i);
+            }
+        });
+        workers.emplace_back([&stack, &seen, &sum, &popped, total]() {
+            int item;
+            while (popped.load() < total) {
+                if (stack.tryPop(item)) {
+                    seen[item]++;
+                    sum += item;
+                    popped++;
+                } else {
+                    this_thread::yield();
+                }
+            }
+        });
+    }
+    for (thread& worker : workers) {
+        worker.join();
+    }
+    int lost = 0;
+    int duplicated = 0;
+    for (atomic<int>& count : seen) {
+        lost += (count.load() == 0) ? 1 : 0;
+        duplicated += (count.load() > 1) ? 1 : 0;
+    }
+    long expected = static_cast<long>(total) * (total - 1) / 2;
+    cout << "   Popped " << popped.load() << " values, sum " << sum.load() << " (expected " << expected << ")"
+         << ", lost " << lost << ", duplicated " << duplicated << endl;
+    cout << "   Is empty: " << (stack.isEmpty() ? "Yes" : "No") << endl;
+    if (lost != 0 || duplicated != 0 || sum.load() != expected || !stack.isEmpty()) {
+        throw runtime_error("ConcurrentStack lost or duplicated values");
+    }
+}
+
+void testConcurrentStack() {
+    cout << "\n=== Testing ConcurrentStack<int> ===" << endl;
+    ConcurrentStack<int> stack;
+    int value;
+    cout << "1. tryPop on empty stack: " << (stack.tryPop(value) ? "got a value" : "false") << endl;
+
+    // 4 producers push 1000 values each while 4 consumers pop concurrently
+    cout << "2. Contended push/pop:" << endl;
+    checkContendedPushPop(stack, 4, 1000);
+
+    // every push and pop goes through the elimination array before the head,
+    // so pushes hand values straight to pops (EMPTY -> offer -> TAKEN -> EMPTY)
+    cout << "3. Contended push/pop through the elimination array:" << endl;
+    ConcurrentStack<int> eliminating = detail::ConcurrentStackTesting::eliminatingStack<int>();
+    checkContendedPushPop(eliminating, 4, 1000);
+}
+
 int main() {
     try {
         testIntStack();
         testStringStack();
         testCharStack();
         testEdgeCases();
+        testMovedFromStack();
+        testConcurrentStack();
 
         cout << "\n=== All tests completed successfully! ===" << endl;
     } catch (const exception& e) {